@@ -1514,6 +1514,7 @@ def child_window(**kwargs):
 		menubar (bool, optional): Shows/Hides the menubar at the top.
 		no_scroll_with_mouse (bool, optional): Disable user vertically scrolling with mouse wheel.
 		flattened_navigation (bool, optional): Allow gamepad/keyboard navigation to cross over parent border to this child (only use on child that have no scrolling!)
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -1578,6 +1579,7 @@ def collapsing_header(**kwargs):
 		open_on_arrow (bool, optional): Only open when clicking on the arrow part.
 		leaf (bool, optional): No collapsing, no arrow (use as a convenience for leaf nodes).
 		bullet (bool, optional): Display a bullet instead of arrow.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -1625,7 +1627,7 @@ def custom_series(x, y, channel_count, **kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		y1 (Any, optional): 
 		y2 (Any, optional): 
@@ -1729,13 +1731,14 @@ def drawlist(width, height, **kwargs):
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -1758,7 +1761,7 @@ def file_dialog(**kwargs):
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		width (int, optional): Width of the item.
 		height (int, optional): Height of the item.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		default_path (str, optional): Path that the file dialog will default to when opened.
 		default_filename (str, optional): Default name that will show in the file name input.
@@ -1794,6 +1797,7 @@ def filter_set(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		show (bool, optional): Attempt to render widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
+		indexed (bool, optional): Builds a trigram index over the children's filter keys so new filters are resolved without testing every child. Useful for very large sets.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -1817,6 +1821,7 @@ def font(file, size, **kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		pixel_snapH (bool, optional): Align every glyph to pixel boundary. Useful e.g. if you are merging a non-pixel aligned font with the default font, or rendering text piece-by-piece (e.g. for coloring).
+		dynamic (bool, optional): Only the default ranges and range hints are rasterized up front. Glyphs of font ranges and chars are rasterized on a worker thread when they are first used in text and added to the atlas on a following frame.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
 		default_font (bool, optional): (deprecated)
@@ -1877,6 +1882,7 @@ def group(**kwargs):
 		horizontal (bool, optional): Forces child widgets to be added in a horizontal layout.
 		horizontal_spacing (float, optional): Spacing for the horizontal layout.
 		xoffset (float, optional): Offset from containing window x item location within group.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -1950,6 +1956,7 @@ def menu(**kwargs):
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2006,6 +2013,7 @@ def node(**kwargs):
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		draggable (bool, optional): Allow node to be draggable.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2036,6 +2044,7 @@ def node_attribute(**kwargs):
 		attribute_type (int, optional): mvNode_Attr_Input, mvNode_Attr_Output, or mvNode_Attr_Static.
 		shape (int, optional): Pin shape.
 		category (str, optional): Category
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2060,7 +2069,7 @@ def node_editor(**kwargs):
 		height (int, optional): Height of the item.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		filter_key (str, optional): Used by filter widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
@@ -2070,6 +2079,7 @@ def node_editor(**kwargs):
 		menubar (bool, optional): Shows or hides the menubar.
 		minimap (bool, optional): Shows or hides the Minimap. New in 1.6.
 		minimap_location (int, optional): mvNodeMiniMap_Location_* constants. New in 1.6.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2096,7 +2106,7 @@ def plot(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -2130,6 +2140,7 @@ def plot(**kwargs):
 		query_toggle_mod (int, optional): when held, active box selections turn into queries
 		horizontal_mod (int, optional): expands active box selection/query horizontally to plot edge when held
 		vertical_mod (int, optional): expands active box selection/query vertically to plot edge when held
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2210,7 +2221,7 @@ def subplots(rows, columns, **kwargs):
 		indent (int, optional): Offsets the widget to the right the specified number multiplied by the indent style.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -2261,6 +2272,7 @@ def tab(**kwargs):
 		closable (bool, optional): Creates a button on the tab that can hide the tab.
 		no_tooltip (bool, optional): Disable tooltip for the given tab.
 		order_mode (bool, optional): set using a constant: mvTabOrder_Reorderable: allows reordering, mvTabOrder_Fixed: fixed ordering, mvTabOrder_Leading: adds tab to front, mvTabOrder_Trailing: adds tab to back
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2284,7 +2296,7 @@ def tab_bar(**kwargs):
 		indent (int, optional): Offsets the widget to the right the specified number multiplied by the indent style.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -2318,7 +2330,7 @@ def table(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -2352,6 +2364,7 @@ def table(**kwargs):
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows in C++ when the sort specs change (stable, multi column) using sort_keys of the columns or the cell values. Rows are drawn in sorted order without being moved; the callback is still sent.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2512,6 +2525,7 @@ def tooltip(parent, **kwargs):
 		show (bool, optional): Attempt to render widget.
 		delay (float, optional): Activation delay: time, in seconds, during which the mouse should stay still in order to display the tooltip.  May be zero for instant activation.
 		hide_on_activity (bool, optional): Hide the tooltip if the user has moved the mouse.  If False, the tooltip will follow mouse pointer.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2550,6 +2564,7 @@ def tree_node(**kwargs):
 		leaf (bool, optional): No collapsing, no arrow (use as a convenience for leaf nodes).
 		bullet (bool, optional): Display a bullet instead of arrow.
 		selectable (bool, optional): Makes the tree selectable.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2665,6 +2680,7 @@ def window(**kwargs):
 		no_open_over_existing_popup (bool, optional): Don't open if there's already a popup
 		no_scroll_with_mouse (bool, optional): Disable user vertically scrolling with mouse wheel.
 		on_close (Callable, optional): Callback ran when window is closed.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2702,6 +2718,7 @@ def add_2d_histogram_series(x, y, **kwargs):
 		ymax_range (float, optional): 
 		density (bool, optional): 
 		outliers (bool, optional): 
+		streaming (bool, optional): Samples are only ever appended to x and y. With fixed bins and ranges, new samples are added to the cached bin counts instead of rebinning everything.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2724,7 +2741,7 @@ def add_3d_slider(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -2740,6 +2757,7 @@ def add_3d_slider(**kwargs):
 		min_y (float, optional): Applies lower limit to slider.
 		min_z (float, optional): Applies lower limit to slider.
 		scale (float, optional): Size of the widget.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2837,7 +2855,7 @@ def add_button(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -2849,6 +2867,7 @@ def add_button(**kwargs):
 		small (bool, optional): Shrinks the size of the button to the text of the label it contains. Useful for embedding in text.
 		arrow (bool, optional): Displays an arrow in place of the text string. This requires the direction keyword.
 		direction (int, optional): Sets the cardinal direction for the arrow by using constants mvDir_Left, mvDir_Up, mvDir_Down, mvDir_Right, mvDir_None. Arrow keyword must be set to True.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2878,6 +2897,7 @@ def add_candle_series(dates, opens, closes, lows, highs, **kwargs):
 		weight (float, optional): 
 		tooltip (bool, optional): 
 		time_unit (int, optional): mvTimeUnit_* constants. Default mvTimeUnit_Day.
+		min_candle_width (float, optional): Merges candles into wider time buckets so bodies stay at least this many pixels wide when zoomed out. 0 disables merging.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2916,7 +2936,7 @@ def add_checkbox(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -2926,6 +2946,7 @@ def add_checkbox(**kwargs):
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		default_value (bool, optional): Sets the default value of the checkmark
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2962,6 +2983,7 @@ def add_child_window(**kwargs):
 		menubar (bool, optional): Shows/Hides the menubar at the top.
 		no_scroll_with_mouse (bool, optional): Disable user vertically scrolling with mouse wheel.
 		flattened_navigation (bool, optional): Allow gamepad/keyboard navigation to cross over parent border to this child (only use on child that have no scrolling!)
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3016,6 +3038,7 @@ def add_collapsing_header(**kwargs):
 		open_on_arrow (bool, optional): Only open when clicking on the arrow part.
 		leaf (bool, optional): No collapsing, no arrow (use as a convenience for leaf nodes).
 		bullet (bool, optional): Display a bullet instead of arrow.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3038,7 +3061,7 @@ def add_color_button(default_value=(0, 0, 0, 255), **kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3050,6 +3073,7 @@ def add_color_button(default_value=(0, 0, 0, 255), **kwargs):
 		no_alpha (bool, optional): Removes the displayed slider that can change alpha channel.
 		no_border (bool, optional): Disable border around the image.
 		no_drag_drop (bool, optional): Disable ability to drag and drop small preview (color square) to apply colors to other items.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3073,7 +3097,7 @@ def add_color_edit(default_value=(0, 0, 0, 255), **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3095,6 +3119,7 @@ def add_color_edit(default_value=(0, 0, 0, 255), **kwargs):
 		display_mode (int, optional): mvColorEdit_rgb, mvColorEdit_hsv, or mvColorEdit_hex
 		display_type (int, optional): mvColorEdit_uint8 or mvColorEdit_float
 		input_mode (int, optional): mvColorEdit_input_rgb or mvColorEdit_input_hsv
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3118,7 +3143,7 @@ def add_color_picker(default_value=(0, 0, 0, 255), **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3141,6 +3166,7 @@ def add_color_picker(default_value=(0, 0, 0, 255), **kwargs):
 		alpha_preview (int, optional): mvColorEdit_AlphaPreviewNone, mvColorEdit_AlphaPreview, or mvColorEdit_AlphaPreviewHalf
 		display_type (int, optional): mvColorEdit_uint8 or mvColorEdit_float
 		input_mode (int, optional): mvColorEdit_input_rgb or mvColorEdit_input_hsv
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3200,7 +3226,7 @@ def add_colormap_button(default_value=(0, 0, 0, 255), **kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3209,6 +3235,7 @@ def add_colormap_button(default_value=(0, 0, 0, 255), **kwargs):
 		filter_key (str, optional): Used by filter widget.
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3253,6 +3280,7 @@ def add_colormap_scale(**kwargs):
 		colormap (Union[int, str], optional): mvPlotColormap_* constants or mvColorMap uuid from a color map registry
 		min_scale (float, optional): Sets the min number of the color scale. Typically is the same as the min scale from the heat series.
 		max_scale (float, optional): Sets the max number of the color scale. Typically is the same as the max scale from the heat series.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 		drag_callback (Callable, optional): (deprecated)
 	Returns:
@@ -3275,7 +3303,7 @@ def add_colormap_slider(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
@@ -3283,6 +3311,7 @@ def add_colormap_slider(**kwargs):
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		default_value (float, optional): 
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 		drag_callback (Callable, optional): (deprecated)
 	Returns:
@@ -3295,7 +3324,7 @@ def add_combo(items=(), **kwargs):
 	"""	 Adds a combo dropdown that allows a user to select a single option from a drop down window. All items will be shown as selectables on the dropdown.
 
 	Args:
-		items (Union[List[str], Tuple[str, ...]], optional): A tuple of items to be shown in the drop down window. Can consist of any combination of types but will convert all items to strings to be shown.
+		items (Union[List[str], Tuple[str, ...]], optional): A tuple of items to be shown in the drop down window. Can consist of any combination of types but will convert all items to strings to be shown. A numpy string array or newline separated bytes are also accepted.
 		label (str, optional): Overrides 'name' as label.
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
@@ -3306,7 +3335,7 @@ def add_combo(items=(), **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3320,6 +3349,10 @@ def add_combo(items=(), **kwargs):
 		no_arrow_button (bool, optional): Display the preview box without the square arrow button indicating dropdown activity.
 		no_preview (bool, optional): Display only the square arrow button and not the selected value.
 		height_mode (int, optional): Controlls the number of items shown in the dropdown by the constants mvComboHeight_Small, mvComboHeight_Regular, mvComboHeight_Large, mvComboHeight_Largest
+		filter (str, optional): Case-insensitive text used to filter the items shown in the dropdown.
+		filter_mode (int, optional): Filter matching by the constants mvItemFilter_Substring, mvItemFilter_Prefix, mvItemFilter_Fuzzy
+		show_filter (bool, optional): Shows a filter input at the top of the dropdown.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3341,7 +3374,7 @@ def add_custom_series(x, y, channel_count, **kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		y1 (Any, optional): 
 		y2 (Any, optional): 
@@ -3354,6 +3387,47 @@ def add_custom_series(x, y, channel_count, **kwargs):
 
 	return internal_dpg.add_custom_series(x, y, channel_count, **kwargs)
 
+def add_data_table(**kwargs):
+	"""	 Adds a table drawn directly from column data. Only visible rows are formatted, so it scales to very large row counts. Use update_data_table to change rows in place.
+
+	Args:
+		label (str, optional): Overrides 'name' as label.
+		user_data (Any, optional): User data for callbacks
+		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
+		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		width (int, optional): Width of the item.
+		height (int, optional): Height of the item.
+		indent (int, optional): Offsets the widget to the right the specified number multiplied by the indent style.
+		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
+		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
+		show (bool, optional): Attempt to render widget.
+		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
+		columns (Any, optional): Column data. Each column is a numeric buffer (i.e. numpy array), a list of numbers or a list of strings.
+		headers (Union[List[str], Tuple[str, ...]], optional): Column headers.
+		formats (Any, optional): Per column printf style format (i.e. '%.3f') or a list of formats, one per cell. Must take a single argument matching the column type (length modifiers such as '%ld' are accepted), other formats raise.
+		highlighted (Union[List[int], Tuple[int, ...]], optional): Rows drawn with highlight_color.
+		highlight_color (Union[List[int], Tuple[int, ...]], optional): 
+		header_row (bool, optional): show headers at the top of the columns
+		selectable (bool, optional): Rows can be selected (ctrl/shift for multiple). The callback receives the clicked row, the value is the list of selected rows.
+		resizable (bool, optional): Enable resizing columns
+		reorderable (bool, optional): Enable reordering columns in header row
+		hideable (bool, optional): Enable hiding/disabling columns in context menu.
+		row_background (bool, optional): Set each RowBg color with ImGuiCol_TableRowBg or ImGuiCol_TableRowBgAlt
+		borders_innerH (bool, optional): Draw horizontal borders between rows.
+		borders_outerH (bool, optional): Draw horizontal borders at the top and bottom.
+		borders_innerV (bool, optional): Draw vertical borders between columns.
+		borders_outerV (bool, optional): Draw vertical borders on the left and right sides.
+		scrollX (bool, optional): Enable horizontal scrolling.
+		scrollY (bool, optional): Enable vertical scrolling.
+		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		id (Union[int, str], optional): (deprecated)
+	Returns:
+		Union[int, str]
+	"""
+
+	return internal_dpg.add_data_table(**kwargs)
+
 def add_date_picker(**kwargs):
 	"""	 Adds a data picker.
 
@@ -3366,7 +3440,7 @@ def add_date_picker(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3376,6 +3450,7 @@ def add_date_picker(**kwargs):
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		default_value (dict, optional): 
 		level (int, optional): Use avaliable constants. mvDatePickerLevel_Day, mvDatePickerLevel_Month, mvDatePickerLevel_Year
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3433,7 +3508,7 @@ def add_drag_double(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3449,6 +3524,7 @@ def add_drag_double(**kwargs):
 		max_value (float, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3470,7 +3546,7 @@ def add_drag_doublex(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3487,6 +3563,7 @@ def add_drag_doublex(**kwargs):
 		max_value (float, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3508,7 +3585,7 @@ def add_drag_float(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3524,6 +3601,7 @@ def add_drag_float(**kwargs):
 		max_value (float, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3545,7 +3623,7 @@ def add_drag_floatx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3562,6 +3640,7 @@ def add_drag_floatx(**kwargs):
 		max_value (float, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3583,7 +3662,7 @@ def add_drag_int(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3599,6 +3678,7 @@ def add_drag_int(**kwargs):
 		max_value (int, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3620,7 +3700,7 @@ def add_drag_intx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -3637,6 +3717,7 @@ def add_drag_intx(**kwargs):
 		max_value (int, optional): Applies a limit only to draging entry only.
 		no_input (bool, optional): Disable direct entry methods or Enter key allowing to input text directly into the widget.
 		clamped (bool, optional): Applies the min and max limits to direct entry methods also such as double click and CTRL+Click.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3655,7 +3736,7 @@ def add_drag_line(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		default_value (Any, optional): 
 		color (Union[List[int], Tuple[int, ...]], optional): 
@@ -3700,7 +3781,7 @@ def add_drag_point(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		default_value (Any, optional): 
 		color (Union[List[int], Tuple[int, ...]], optional): 
@@ -3764,13 +3845,14 @@ def add_drawlist(width, height, **kwargs):
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3832,7 +3914,7 @@ def add_file_dialog(**kwargs):
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		width (int, optional): Width of the item.
 		height (int, optional): Height of the item.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		default_path (str, optional): Path that the file dialog will default to when opened.
 		default_filename (str, optional): Default name that will show in the file name input.
@@ -3885,6 +3967,7 @@ def add_filter_set(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		show (bool, optional): Attempt to render widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
+		indexed (bool, optional): Builds a trigram index over the children's filter keys so new filters are resolved without testing every child. Useful for very large sets.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3957,6 +4040,7 @@ def add_font(file, size, **kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		pixel_snapH (bool, optional): Align every glyph to pixel boundary. Useful e.g. if you are merging a non-pixel aligned font with the default font, or rendering text piece-by-piece (e.g. for coloring).
+		dynamic (bool, optional): Only the default ranges and range hints are rasterized up front. Glyphs of font ranges and chars are rasterized on a worker thread when they are first used in text and added to the atlas on a following frame.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
 		default_font (bool, optional): (deprecated)
@@ -4059,6 +4143,7 @@ def add_group(**kwargs):
 		horizontal (bool, optional): Forces child widgets to be added in a horizontal layout.
 		horizontal_spacing (float, optional): Spacing for the horizontal layout.
 		xoffset (float, optional): Offset from containing window x item location within group.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4103,6 +4188,7 @@ def add_heat_series(x, rows, cols, **kwargs):
 		bounds_max (Any, optional): 
 		format (str, optional): 
 		contribute_to_bounds (bool, optional): 
+		texture (bool, optional): Colormaps the values into a single texture instead of drawing a rect per cell. Large series are downsampled to screen resolution, only changed cells are re-uploaded and format is ignored.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4131,6 +4217,7 @@ def add_histogram_series(x, **kwargs):
 		density (bool, optional): 
 		outliers (bool, optional): 
 		contribute_to_bounds (bool, optional): 
+		streaming (bool, optional): Samples are only ever appended to x. With fixed bins and range, new samples are added to the cached bin counts instead of rebinning everything.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4185,6 +4272,7 @@ def add_image(texture_tag, **kwargs):
 		border_color (Union[List[float], Tuple[float, ...]], optional): Displays a border of the specified color around the texture. If the theme style has turned off the border it will not be shown.
 		uv_min (Union[List[float], Tuple[float, ...]], optional): Normalized texture coordinates min point.
 		uv_max (Union[List[float], Tuple[float, ...]], optional): Normalized texture coordinates max point.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4208,7 +4296,7 @@ def add_image_button(texture_tag, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4222,6 +4310,7 @@ def add_image_button(texture_tag, **kwargs):
 		background_color (Union[List[float], Tuple[float, ...]], optional): Displays a border of the specified color around the texture.
 		uv_min (Union[List[float], Tuple[float, ...]], optional): Normalized texture coordinates min point.
 		uv_max (Union[List[float], Tuple[float, ...]], optional): Normalized texture coordinates max point.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4268,7 +4357,7 @@ def add_input_double(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4287,6 +4376,7 @@ def add_input_double(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter key press.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4308,7 +4398,7 @@ def add_input_doublex(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4326,6 +4416,7 @@ def add_input_doublex(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter key press.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4347,7 +4438,7 @@ def add_input_float(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4366,6 +4457,7 @@ def add_input_float(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter key press.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4387,7 +4479,7 @@ def add_input_floatx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4405,6 +4497,7 @@ def add_input_floatx(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter key press.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4426,7 +4519,7 @@ def add_input_int(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4444,6 +4537,7 @@ def add_input_int(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter key press.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4465,7 +4559,7 @@ def add_input_intx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4482,6 +4576,7 @@ def add_input_intx(**kwargs):
 		max_clamped (bool, optional): Activates and deactivates the enforcment of max_value.
 		on_enter (bool, optional): Only runs callback on enter.
 		readonly (bool, optional): Activates read only mode where no text can be input but text can still be highlighted.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4504,7 +4599,7 @@ def add_input_text(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4525,6 +4620,7 @@ def add_input_text(**kwargs):
 		password (bool, optional): Display all input characters as '*'.
 		scientific (bool, optional): Only allow characters 0123456789.+-*/eE (Scientific notation input)
 		on_enter (bool, optional): Only runs callback on enter key press.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4577,7 +4673,7 @@ def add_item_activated_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4595,7 +4691,7 @@ def add_item_active_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4614,7 +4710,7 @@ def add_item_clicked_handler(button=-1, **kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4632,7 +4728,7 @@ def add_item_deactivated_after_edit_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4650,7 +4746,7 @@ def add_item_deactivated_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4669,7 +4765,7 @@ def add_item_double_clicked_handler(button=-1, **kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4687,7 +4783,7 @@ def add_item_edited_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4705,7 +4801,7 @@ def add_item_focus_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4739,7 +4835,7 @@ def add_item_hover_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4757,7 +4853,7 @@ def add_item_resize_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4775,7 +4871,7 @@ def add_item_toggled_open_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4793,7 +4889,7 @@ def add_item_visible_handler(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -4811,7 +4907,7 @@ def add_key_down_handler(key=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -4830,7 +4926,7 @@ def add_key_press_handler(key=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -4849,7 +4945,7 @@ def add_key_release_handler(key=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -4874,7 +4970,7 @@ def add_knob_float(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4886,6 +4982,7 @@ def add_knob_float(**kwargs):
 		default_value (float, optional): 
 		min_value (float, optional): Applies lower limit to value.
 		max_value (float, optional): Applies upper limit to value.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4929,7 +5026,7 @@ def add_listbox(items=(), **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -4940,6 +5037,10 @@ def add_listbox(items=(), **kwargs):
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		default_value (str, optional): String value of the item that will be selected by default.
 		num_items (int, optional): Expands the height of the listbox to show specified number of items.
+		filter (str, optional): Case-insensitive text used to filter the items shown in the listbox.
+		filter_mode (int, optional): Filter matching by the constants mvItemFilter_Substring, mvItemFilter_Prefix, mvItemFilter_Fuzzy
+		show_filter (bool, optional): Shows a filter input above the listbox.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4971,6 +5072,7 @@ def add_loading_indicator(**kwargs):
 		thickness (float, optional): Thickness of the circles or line.
 		color (Union[List[int], Tuple[int, ...]], optional): Color of the growing center circle.
 		secondary_color (Union[List[int], Tuple[int, ...]], optional): Background of the dots in dot mode.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4997,6 +5099,7 @@ def add_menu(**kwargs):
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5035,7 +5138,7 @@ def add_menu_item(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
 		enabled (bool, optional): Turns off functionality of widget and applies the disabled theme.
@@ -5062,7 +5165,7 @@ def add_mouse_click_handler(button=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5081,7 +5184,7 @@ def add_mouse_double_click_handler(button=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5100,7 +5203,7 @@ def add_mouse_down_handler(button=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5120,7 +5223,7 @@ def add_mouse_drag_handler(button=-1, threshold=10.0, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5138,7 +5241,7 @@ def add_mouse_move_handler(**kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5157,7 +5260,7 @@ def add_mouse_release_handler(button=-1, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5175,7 +5278,7 @@ def add_mouse_wheel_handler(**kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
@@ -5205,6 +5308,7 @@ def add_node(**kwargs):
 		tracked (bool, optional): Scroll tracking
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		draggable (bool, optional): Allow node to be draggable.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5230,6 +5334,7 @@ def add_node_attribute(**kwargs):
 		attribute_type (int, optional): mvNode_Attr_Input, mvNode_Attr_Output, or mvNode_Attr_Static.
 		shape (int, optional): Pin shape.
 		category (str, optional): Category
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5249,7 +5354,7 @@ def add_node_editor(**kwargs):
 		height (int, optional): Height of the item.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		filter_key (str, optional): Used by filter widget.
 		delay_search (bool, optional): Delays searching container for specified items until the end of the app. Possible optimization when a container has many children that are not accessed often.
@@ -5259,6 +5364,7 @@ def add_node_editor(**kwargs):
 		menubar (bool, optional): Shows or hides the menubar.
 		minimap (bool, optional): Shows or hides the Minimap. New in 1.6.
 		minimap_location (int, optional): mvNodeMiniMap_Location_* constants. New in 1.6.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5278,6 +5384,7 @@ def add_node_link(attr_1, attr_2, **kwargs):
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		show (bool, optional): Attempt to render widget.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5326,7 +5433,7 @@ def add_plot(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5360,6 +5467,7 @@ def add_plot(**kwargs):
 		query_toggle_mod (int, optional): when held, active box selections turn into queries
 		horizontal_mod (int, optional): expands active box selection/query horizontally to plot edge when held
 		vertical_mod (int, optional): expands active box selection/query vertically to plot edge when held
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5485,7 +5593,7 @@ def add_radio_button(items=(), **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5496,6 +5604,7 @@ def add_radio_button(items=(), **kwargs):
 		track_offset (float, optional): 0.0f:top, 0.5f:center, 1.0f:bottom
 		default_value (str, optional): Default selected radio option. Set by using the string value of the item.
 		horizontal (bool, optional): Displays the radio options horizontally.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5537,6 +5646,7 @@ def add_scatter_series(x, y, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		density_threshold (int, optional): Above this many points, only one marker is drawn per occupied marker-sized cell of the plot area. Cells are rebinned on a worker thread when the limits or data change. 0 disables.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5559,7 +5669,7 @@ def add_selectable(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5571,6 +5681,7 @@ def add_selectable(**kwargs):
 		default_value (bool, optional): 
 		span_columns (bool, optional): Forces the selectable to span the width of all columns if placed in a table.
 		disable_popup_close (bool, optional): Disable closing a modal or popup window.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5687,7 +5798,7 @@ def add_slider_double(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5703,6 +5814,7 @@ def add_slider_double(**kwargs):
 		min_value (float, optional): Applies a limit only to sliding entry only.
 		max_value (float, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the float will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5724,7 +5836,7 @@ def add_slider_doublex(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5740,6 +5852,7 @@ def add_slider_doublex(**kwargs):
 		min_value (float, optional): Applies a limit only to sliding entry only.
 		max_value (float, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the int will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5762,7 +5875,7 @@ def add_slider_float(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5778,6 +5891,7 @@ def add_slider_float(**kwargs):
 		min_value (float, optional): Applies a limit only to sliding entry only.
 		max_value (float, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the float will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5799,7 +5913,7 @@ def add_slider_floatx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5815,6 +5929,7 @@ def add_slider_floatx(**kwargs):
 		min_value (float, optional): Applies a limit only to sliding entry only.
 		max_value (float, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the int will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5837,7 +5952,7 @@ def add_slider_int(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5853,6 +5968,7 @@ def add_slider_int(**kwargs):
 		min_value (int, optional): Applies a limit only to sliding entry only.
 		max_value (int, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the int will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5874,7 +5990,7 @@ def add_slider_intx(**kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -5890,6 +6006,7 @@ def add_slider_intx(**kwargs):
 		min_value (int, optional): Applies a limit only to sliding entry only.
 		max_value (int, optional): Applies a limit only to sliding entry only.
 		format (str, optional): Determines the format the int will be displayed as use python string formatting.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6029,7 +6146,7 @@ def add_subplots(rows, columns, **kwargs):
 		indent (int, optional): Offsets the widget to the right the specified number multiplied by the indent style.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -6075,6 +6192,7 @@ def add_tab(**kwargs):
 		closable (bool, optional): Creates a button on the tab that can hide the tab.
 		no_tooltip (bool, optional): Disable tooltip for the given tab.
 		order_mode (bool, optional): set using a constant: mvTabOrder_Reorderable: allows reordering, mvTabOrder_Fixed: fixed ordering, mvTabOrder_Leading: adds tab to front, mvTabOrder_Trailing: adds tab to back
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6093,7 +6211,7 @@ def add_tab_bar(**kwargs):
 		indent (int, optional): Offsets the widget to the right the specified number multiplied by the indent style.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -6120,7 +6238,7 @@ def add_tab_button(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -6152,7 +6270,7 @@ def add_table(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		show (bool, optional): Attempt to render widget.
 		pos (Union[List[int], Tuple[int, ...]], optional): Places the item relative to window coordinates, [0,0] is top left.
 		filter_key (str, optional): Used by filter widget.
@@ -6186,6 +6304,7 @@ def add_table(**kwargs):
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows in C++ when the sort specs change (stable, multi column) using sort_keys of the columns or the cell values. Rows are drawn in sorted order without being moved; the callback is still sent.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6243,6 +6362,8 @@ def add_table_column(**kwargs):
 		prefer_sort_descending (bool, optional): Make the initial sort direction Descending when first sorting on this column.
 		indent_enable (bool, optional): Use current Indent value when entering cell (default for column 0).
 		indent_disable (bool, optional): Ignore current Indent value when entering cell (default for columns > 0). Indentation changes _within_ the cell will still be honored.
+		sort_keys (Any, optional): Numbers or strings, one per row, used by native_sort instead of the cell values.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6310,6 +6431,7 @@ def add_text(default_value='', **kwargs):
 		bullet (bool, optional): Places a bullet to the left of the text.
 		color (Union[List[int], Tuple[int, ...]], optional): Color of the text (rgba).
 		show_label (bool, optional): Displays the label to the right of the text.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6443,7 +6565,7 @@ def add_time_picker(**kwargs):
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		payload_type (str, optional): Sender string type must be the same as the target for the target to run the payload_callback.
-		callback (Callable, optional): Registers a callback.
+		callback (Callable, optional): Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h).
 		drag_callback (Callable, optional): Registers a drag callback for drag and drop.
 		drop_callback (Callable, optional): Registers a drop callback for drag and drop.
 		show (bool, optional): Attempt to render widget.
@@ -6472,6 +6594,7 @@ def add_tooltip(parent, **kwargs):
 		show (bool, optional): Attempt to render widget.
 		delay (float, optional): Activation delay: time, in seconds, during which the mouse should stay still in order to display the tooltip.  May be zero for instant activation.
 		hide_on_activity (bool, optional): Hide the tooltip if the user has moved the mouse.  If False, the tooltip will follow mouse pointer.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6505,6 +6628,7 @@ def add_tree_node(**kwargs):
 		leaf (bool, optional): No collapsing, no arrow (use as a convenience for leaf nodes).
 		bullet (bool, optional): Display a bullet instead of arrow.
 		selectable (bool, optional): Makes the tree selectable.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6620,6 +6744,7 @@ def add_window(**kwargs):
 		no_open_over_existing_popup (bool, optional): Don't open if there's already a popup
 		no_scroll_with_mouse (bool, optional): Disable user vertically scrolling with mouse wheel.
 		on_close (Callable, optional): Callback ran when window is closed.
+		track_state (bool, optional): Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6639,6 +6764,19 @@ def apply_transform(item, transform):
 
 	return internal_dpg.apply_transform(item, transform)
 
+def apply_transform_points(matrix, points, **kwargs):
+	"""	 Applies a transformation matrix to many points at once. Returns an Nx4 float32 memoryview for buffer input, otherwise a list of lists.
+
+	Args:
+		matrix (Any): Transformation matrix.
+		points (Any): Nx2, Nx3 or Nx4 points as a float32/float64 buffer (i.e. numpy array) or a list of lists. Missing z and w default to 0 and 1.
+		perspective_divide (bool, optional): Divides x, y and z by w.
+	Returns:
+		Any
+	"""
+
+	return internal_dpg.apply_transform_points(matrix, points, **kwargs)
+
 def bind_colormap(item, source):
 	"""	 Sets the color map for widgets that accept it.
 
@@ -6743,6 +6881,21 @@ def clear_selected_nodes(node_editor):
 
 	return internal_dpg.clear_selected_nodes(node_editor)
 
+def clone_item(item, **kwargs):
+	"""	 Copies an item and its children with new uuids. Configuration, callbacks, values and bindings are copied; sources and bindings inside the subtree are remapped to the copies. Copies are created by replaying the configuration as reported by get_item_configuration, state not exposed there is not copied. Returns the new roots.
+
+	Args:
+		item (Union[int, str]): 
+		parent (Union[int, str], optional): Parent of the copies, the item's own parent if 0.
+		count (int, optional): Number of copies.
+		share_values (bool, optional): Copies use the original items as value sources instead of holding their own values.
+		alias_pattern (str, optional): Alias for copies of aliased items, '{alias}' and '{n}' (copy index) are substituted; '{n}' is required when count is greater than 1. Copies have no alias if empty.
+	Returns:
+		Union[List[int], Tuple[int, ...]]
+	"""
+
+	return internal_dpg.clone_item(item, **kwargs)
+
 def create_context():
 	"""	 Creates the Dear PyGui context.
 
@@ -6864,6 +7017,10 @@ def create_viewport(**kwargs):
 		decorated (bool, optional): Enabled and disabled the decorator bar at the top of the viewport.
 		clear_color (Union[List[float], Tuple[float, ...]], optional): Sets the color of the back of the viewport.
 		disable_close (bool, optional): Disables the viewport close button. can be used with set_exit_callback
+		max_fps (float, optional): Caps the frame rate of render_dearpygui_frame. 0 is uncapped. Works with or without vsync.
+		min_frame_time (float, optional): Minimum time in seconds a frame takes. The stricter of this and max_fps applies.
+		adaptive_fps (bool, optional): Drops to idle_fps while the viewport is unfocused, minimized or has had no input for a second.
+		idle_fps (float, optional): Frame rate used by adaptive_fps when idle.
 	Returns:
 		None
 	"""
@@ -6938,6 +7095,38 @@ def draw_arrow(p1, p2, **kwargs):
 
 	return internal_dpg.draw_arrow(p1, p2, **kwargs)
 
+def draw_batch(**kwargs):
+	"""	 Adds a batch of primitives stored as columns. Use update_draw_batch to overwrite a range of rows.
+
+	Args:
+		label (str, optional): Overrides 'name' as label.
+		user_data (Any, optional): User data for callbacks
+		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
+		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
+		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
+		show (bool, optional): Attempt to render widget.
+		kind (int, optional): mvDrawBatch_Lines, mvDrawBatch_Circles, mvDrawBatch_Rects, mvDrawBatch_Triangles or mvDrawBatch_Points
+		p1 (Any, optional): Nx2 or Nx3 column of line starts, rect minimums, first triangle vertices or centers. float32 buffers are drawn without copying.
+		p2 (Any, optional): Nx2 or Nx3 column of line ends, rect maximums or second triangle vertices.
+		p3 (Any, optional): Nx2 or Nx3 column of third triangle vertices.
+		center (Any, optional): Same column as p1, for circles and points.
+		radii (Any, optional): Per primitive radius for circles and points (points are squares of this half size).
+		thicknesses (Any, optional): Per primitive thickness.
+		colors (Any, optional): Per primitive color, either packed uint32 or Nx4 in 0-255.
+		color (Union[List[int], Tuple[int, ...]], optional): Used when colors is not set.
+		radius (float, optional): Used when radii is not set.
+		thickness (float, optional): Used when thicknesses is not set.
+		fill (bool, optional): Fills circles, rects and triangles with their color.
+		segments (int, optional): Number of segments to approximate circles.
+		count (int, optional): Number of rows to draw, -1 draws every row.
+		id (Union[int, str], optional): (deprecated)
+	Returns:
+		Union[int, str]
+	"""
+
+	return internal_dpg.draw_batch(**kwargs)
+
 def draw_bezier_cubic(p1, p2, p3, p4, **kwargs):
 	"""	 Adds a cubic bezier curve.
 
@@ -7451,6 +7640,16 @@ def get_frame_rate():
 
 	return internal_dpg.get_frame_rate()
 
+def get_frame_statistics():
+	"""	 Returns achieved frame time statistics (seconds) across the last 120 paced frames: target_frame_time, mean, min, max, fps and frames.
+
+	Args:
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_frame_statistics()
+
 def get_global_font_scale():
 	"""	 Returns global font scale.
 
@@ -7505,6 +7704,18 @@ def get_item_state(item):
 
 	return internal_dpg.get_item_state(item)
 
+def get_item_states(items, **kwargs):
+	"""	 Returns the state of many items at once as a dict of field name to a buffer with one row per item, e.g. numpy.asarray(states['visible']). Missing items and states not applicable to an item read as false/0.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+		fields (Union[List[str], Tuple[str, ...]], optional): State fields to return. Flags (ok, hovered, active, focused, clicked, left_clicked, right_clicked, middle_clicked, visible, edited, activated, deactivated, deactivated_after_edit, toggled_open, resized) are returned as bool buffers of shape (N,). pos, rect_min, rect_max, rect_size and content_region_avail are float buffers of shape (N, 2), rect is (N, 4) as min x, min y, max x, max y.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_item_states(items, **kwargs)
+
 def get_item_types():
 	"""	 Returns an item types.
 
@@ -7536,6 +7747,17 @@ def get_mouse_pos(**kwargs):
 
 	return internal_dpg.get_mouse_pos(**kwargs)
 
+def get_parser_build_times(**kwargs):
+	"""	 Returns a dictionary of command name to the time in seconds spent building its parser. Parsers are built on first use of each command, so only commands used so far are listed unless build_all is set.
+
+	Args:
+		build_all (bool, optional): Builds every remaining parser first, giving the full cost an eager import would pay.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_parser_build_times(**kwargs)
+
 def get_platform():
 	"""	 New in 1.6. Returns platform constant.
 
@@ -7939,6 +8161,19 @@ def load_image(file, **kwargs):
 
 	return internal_dpg.load_image(file, **kwargs)
 
+def load_item_tree(file, **kwargs):
+	"""	 Restores an item tree saved by save_item_tree and returns the new root. Sources and bindings inside the tree are remapped to the restored items, those outside it are looked up by alias and dropped if there is none. Only load files from trusted sources.
+
+	Args:
+		file (str): 
+		parent (Union[int, str], optional): Parent to add the restored tree to.
+		callbacks (dict, optional): Maps saved callback names to callables.
+	Returns:
+		Union[int, str]
+	"""
+
+	return internal_dpg.load_item_tree(file, **kwargs)
+
 def lock_mutex():
 	"""	 Locks render thread mutex.
 
@@ -8132,6 +8367,18 @@ def save_init_file(file):
 
 	return internal_dpg.save_init_file(file)
 
+def save_item_tree(item, file):
+	"""	 Saves an item and its children (types, configuration and values) to a binary file. Callbacks are stored by qualified name. Themes, fonts and handler registries are not saved, only the bindings to them, by alias where the target has one. Loading replays the configuration like the add_* commands, it is not faster than creating the items from Python.
+
+	Args:
+		item (Union[int, str]): 
+		file (str): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.save_item_tree(item, file)
+
 def set_axis_limits(axis, ymin, ymax):
 	"""	 Sets limits on the axis for pan and zoom.
 
@@ -8455,6 +8702,29 @@ def split_frame(**kwargs):
 
 	return internal_dpg.split_frame(**kwargs)
 
+def start_input_recording(file):
+	"""	 Records the input of every following frame (mouse, keys, wheel, text, viewport size and frame delta) into a binary file until stop_input_recording is called.
+
+	Args:
+		file (str): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.start_input_recording(file)
+
+def start_input_replay(file, **kwargs):
+	"""	 Replays an input recording without a window system. Each render_dearpygui_frame feeds one recorded frame to Dear PyGui, and is_dearpygui_running turns false after the last one. Requires create_viewport and setup_dearpygui, but not show_viewport. Textures are not created while replaying.
+
+	Args:
+		file (str): 
+		time_step (float, optional): Fixed frame delta in seconds. 0 uses the recorded deltas.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.start_input_replay(file, **kwargs)
+
 def stop_dearpygui():
 	"""	 Stops Dear PyGui
 
@@ -8465,6 +8735,26 @@ def stop_dearpygui():
 
 	return internal_dpg.stop_dearpygui()
 
+def stop_input_recording():
+	"""	 Stops recording input and closes the file.
+
+	Args:
+	Returns:
+		None
+	"""
+
+	return internal_dpg.stop_input_recording()
+
+def stop_input_replay():
+	"""	 Stops replaying input and returns the time in seconds spent on each replayed frame.
+
+	Args:
+	Returns:
+		Union[List[float], Tuple[float, ...]]
+	"""
+
+	return internal_dpg.stop_input_replay()
+
 def toggle_viewport_fullscreen():
 	"""	 Toggle viewport fullscreen mode..
 
@@ -8555,6 +8845,38 @@ def unstage(item):
 
 	return internal_dpg.unstage(item)
 
+def update_data_table(item, start, columns):
+	"""	 Overwrites rows of a data table in place.
+
+	Args:
+		item (Union[int, str]): Data table to update.
+		start (int): First row to overwrite. Columns grow if needed.
+		columns (Any): New values per column (None leaves a column untouched).
+	Returns:
+		None
+	"""
+
+	return internal_dpg.update_data_table(item, start, columns)
+
+def update_draw_batch(item, start, **kwargs):
+	"""	 Overwrites rows of a draw batch's columns starting at 'start'. Copied columns grow as needed, bound buffers must be writable and large enough.
+
+	Args:
+		item (Union[int, str]): Draw batch to update.
+		start (int): First row to overwrite.
+		p1 (Any, optional): 
+		p2 (Any, optional): 
+		p3 (Any, optional): 
+		center (Any, optional): 
+		radii (Any, optional): 
+		thicknesses (Any, optional): 
+		colors (Any, optional): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.update_draw_batch(item, start, **kwargs)
+
 
 ##########################################################
 # Constants #
@@ -8734,6 +9056,9 @@ mvComboHeight_Small=internal_dpg.mvComboHeight_Small
 mvComboHeight_Regular=internal_dpg.mvComboHeight_Regular
 mvComboHeight_Large=internal_dpg.mvComboHeight_Large
 mvComboHeight_Largest=internal_dpg.mvComboHeight_Largest
+mvItemFilter_Substring=internal_dpg.mvItemFilter_Substring
+mvItemFilter_Prefix=internal_dpg.mvItemFilter_Prefix
+mvItemFilter_Fuzzy=internal_dpg.mvItemFilter_Fuzzy
 mvPlatform_Windows=internal_dpg.mvPlatform_Windows
 mvPlatform_Apple=internal_dpg.mvPlatform_Apple
 mvPlatform_Linux=internal_dpg.mvPlatform_Linux
@@ -8784,6 +9109,11 @@ mvDatePickerLevel_Year=internal_dpg.mvDatePickerLevel_Year
 mvCullMode_None=internal_dpg.mvCullMode_None
 mvCullMode_Back=internal_dpg.mvCullMode_Back
 mvCullMode_Front=internal_dpg.mvCullMode_Front
+mvDrawBatch_Lines=internal_dpg.mvDrawBatch_Lines
+mvDrawBatch_Circles=internal_dpg.mvDrawBatch_Circles
+mvDrawBatch_Rects=internal_dpg.mvDrawBatch_Rects
+mvDrawBatch_Triangles=internal_dpg.mvDrawBatch_Triangles
+mvDrawBatch_Points=internal_dpg.mvDrawBatch_Points
 mvFontRangeHint_Default=internal_dpg.mvFontRangeHint_Default
 mvFontRangeHint_Japanese=internal_dpg.mvFontRangeHint_Japanese
 mvFontRangeHint_Korean=internal_dpg.mvFontRangeHint_Korean
@@ -9180,6 +9510,8 @@ mvDragDoubleMulti=internal_dpg.mvDragDoubleMulti
 mvSliderDouble=internal_dpg.mvSliderDouble
 mvSliderDoubleMulti=internal_dpg.mvSliderDoubleMulti
 mvCustomSeries=internal_dpg.mvCustomSeries
+mvDrawBatch=internal_dpg.mvDrawBatch
+mvDataTable=internal_dpg.mvDataTable
 mvReservedUUID_0=internal_dpg.mvReservedUUID_0
 mvReservedUUID_1=internal_dpg.mvReservedUUID_1
 mvReservedUUID_2=internal_dpg.mvReservedUUID_2
@@ -13,17 +13,19 @@
 #include "dearpygui_commands.h"
 #include "dearpygui_parsers.h"
 
-#define MV_ADD_COMMAND(x) methods.push_back({ #x, (PyCFunction)x, METH_VARARGS | METH_KEYWORDS, GetParsers()[#x].documentation.c_str() });
+#define MV_ADD_COMMAND(x) methods.push_back({ #x, (PyCFunction)x, METH_VARARGS | METH_KEYWORDS, nullptr });
 
-const std::map<std::string, mvPythonParser>& 
-GetModuleParsers()
+mvParserRegistry&
+GetModuleParserRegistry()
 {
 
-	static auto parsers = std::map<std::string, mvPythonParser>();
+	static mvParserRegistry registry;
 
-	if (parsers.empty())
-	{
-		#define X(el) parsers.insert({GetEntityCommand(mvAppItemType::el), DearPyGui::GetEntityParser(mvAppItemType::el)});
+	// only builders are registered here, parsers are built on first use
+	static bool initialized = []() {
+		std::map<std::string, mvParserBuilder>& parsers = registry.builders;
+
+		#define X(el) parsers.insert({GetEntityCommand(mvAppItemType::el), []() { return DearPyGui::GetEntityParser(mvAppItemType::el); }});
 		MV_ITEM_TYPES
 		#undef X
 
@@ -33,8 +35,19 @@ GetModuleParsers()
 		InsertParser_Block2(parsers);
 		InsertParser_Block3(parsers);
 		InsertParser_Block4(parsers);
-	}
-	return parsers;
+		return true;
+	}();
+	(void)initialized;
+
+	return registry;
+}
+
+const std::map<std::string, mvPythonParser>& 
+GetModuleParsers()
+{
+	mvParserRegistry& registry = GetModuleParserRegistry();
+	BuildAllParsers(registry);
+	return registry.parsers;
 }
 
 const std::vector<std::pair<std::string, long>>&
@@ -67,6 +80,9 @@ GetModuleConstants()
 		ModuleConstants.push_back({"mvComboHeight_Regular", 1L });
 		ModuleConstants.push_back({"mvComboHeight_Large", 2L });
 		ModuleConstants.push_back({"mvComboHeight_Largest", 3L });
+		ModuleConstants.push_back({"mvItemFilter_Substring", 0L });
+		ModuleConstants.push_back({"mvItemFilter_Prefix", 1L });
+		ModuleConstants.push_back({"mvItemFilter_Fuzzy", 2L });
 
 		ModuleConstants.push_back({"mvPlatform_Windows", 0L });
 		ModuleConstants.push_back({"mvPlatform_Apple", 1L });
@@ -126,6 +142,12 @@ GetModuleConstants()
 		ModuleConstants.push_back({ "mvCullMode_Back", 1L });
 		ModuleConstants.push_back({ "mvCullMode_Front", 2L });
 
+		ModuleConstants.push_back({ "mvDrawBatch_Lines", 0L });
+		ModuleConstants.push_back({ "mvDrawBatch_Circles", 1L });
+		ModuleConstants.push_back({ "mvDrawBatch_Rects", 2L });
+		ModuleConstants.push_back({ "mvDrawBatch_Triangles", 3L });
+		ModuleConstants.push_back({ "mvDrawBatch_Points", 4L });
+
 		ModuleConstants.push_back({ "mvFontRangeHint_Default", 0L });
 		ModuleConstants.push_back({ "mvFontRangeHint_Japanese", 1L });
 		ModuleConstants.push_back({ "mvFontRangeHint_Korean", 2L });
@@ -498,7 +520,7 @@ PyInit__dearpygui(void)
 	static std::vector<PyMethodDef> methods;
 	methods.clear();
 
-	#define X(el) methods.push_back({GetEntityCommand(mvAppItemType::el), (PyCFunction)el##_command, METH_VARARGS | METH_KEYWORDS, GetParsers()[GetEntityCommand(mvAppItemType::el)].documentation.c_str()});
+	#define X(el) methods.push_back({GetEntityCommand(mvAppItemType::el), (PyCFunction)el##_command, METH_VARARGS | METH_KEYWORDS, nullptr});
 	MV_ITEM_TYPES
 	#undef X
 
@@ -523,6 +545,9 @@ PyInit__dearpygui(void)
 
 	// draw node
 	MV_ADD_COMMAND(apply_transform);
+	MV_ADD_COMMAND(apply_transform_points);
+	MV_ADD_COMMAND(update_draw_batch);
+	MV_ADD_COMMAND(update_data_table);
 	MV_ADD_COMMAND(create_rotation_matrix);
 	MV_ADD_COMMAND(create_translation_matrix);
 	MV_ADD_COMMAND(create_scale_matrix);
@@ -596,6 +621,10 @@ PyInit__dearpygui(void)
 	MV_ADD_COMMAND(unlock_mutex);
 	MV_ADD_COMMAND(setup_dearpygui);
 	MV_ADD_COMMAND(render_dearpygui_frame);
+	MV_ADD_COMMAND(start_input_recording);
+	MV_ADD_COMMAND(stop_input_recording);
+	MV_ADD_COMMAND(start_input_replay);
+	MV_ADD_COMMAND(stop_input_replay);
 	MV_ADD_COMMAND(get_delta_time);
 	MV_ADD_COMMAND(get_total_time);
 	MV_ADD_COMMAND(stop_dearpygui);
@@ -607,7 +636,9 @@ PyInit__dearpygui(void)
 	MV_ADD_COMMAND(save_image);
 	MV_ADD_COMMAND(split_frame);
 	MV_ADD_COMMAND(get_frame_count);
+	MV_ADD_COMMAND(get_parser_build_times);
 	MV_ADD_COMMAND(get_frame_rate);
+	MV_ADD_COMMAND(get_frame_statistics);
 	MV_ADD_COMMAND(get_app_configuration);
 	MV_ADD_COMMAND(configure_app);
 	MV_ADD_COMMAND(get_drawing_mouse_pos);
@@ -661,12 +692,16 @@ PyInit__dearpygui(void)
 	MV_ADD_COMMAND(get_item_types);
 	MV_ADD_COMMAND(get_item_configuration);
 	MV_ADD_COMMAND(get_item_state);
+	MV_ADD_COMMAND(get_item_states);
 	MV_ADD_COMMAND(configure_item);
 	MV_ADD_COMMAND(get_value);
 	MV_ADD_COMMAND(get_values);
 	MV_ADD_COMMAND(set_value);
 	MV_ADD_COMMAND(reset_pos);
 	MV_ADD_COMMAND(set_item_children);
+	MV_ADD_COMMAND(save_item_tree);
+	MV_ADD_COMMAND(load_item_tree);
+	MV_ADD_COMMAND(clone_item);
 	MV_ADD_COMMAND(bind_item_handler_registry);
 	MV_ADD_COMMAND(bind_item_font);
 	MV_ADD_COMMAND(bind_item_theme);
@@ -675,6 +710,9 @@ PyInit__dearpygui(void)
 
 	methods.push_back({ NULL, NULL, 0, NULL });
 
+	// docstrings are attached as each parser is built
+	RegisterParserMethods(GetModuleParserRegistry(), methods);
+
 	static PyModuleDef dearpyguiModule = {
 		PyModuleDef_HEAD_INIT, "_dearpygui", NULL, -1, methods.data(),
 		NULL, NULL, NULL, NULL
@@ -6,5 +6,6 @@
 
 PyMODINIT_FUNC PyInit__dearpygui(void);
 
-const std::map<std::string, mvPythonParser>& GetModuleParsers();
+mvParserRegistry&                            GetModuleParserRegistry();
+const std::map<std::string, mvPythonParser>& GetModuleParsers(); // builds every parser
 const std::vector<std::pair<std::string, long>>& GetModuleConstants();
\ No newline at end of file
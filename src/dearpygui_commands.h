@@ -11,6 +11,7 @@
 #include "stb_image_write.h"
 #include "mvProfiler.h"
 #include "mvUtilities.h"
+#include <marshal.h>
 
 static PyObject*
 bind_colormap(PyObject* self, PyObject* args, PyObject* kwargs)
@@ -596,6 +597,189 @@ apply_transform(PyObject* self, PyObject* args, PyObject* kwargs)
 	return GetPyNone();
 }
 
+static PyObject*
+apply_transform_points(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* matrix;
+	PyObject* points;
+	int perspectiveDivide = false;
+
+	if (!Parse((GetParsers())["apply_transform_points"], args, kwargs, __FUNCTION__, &matrix, &points, &perspectiveDivide))
+		return GetPyNone();
+
+	if (!PyObject_TypeCheck(matrix, &PymvMat4Type))
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, "apply_transform_points",
+			"Incompatible type. Expected types include: mvMat4", nullptr);
+		return GetPyNone();
+	}
+	const mvMat4& transform = ((PymvMat4*)matrix)->m;
+
+	// buffer input (i.e. numpy), transformed without going through python objects
+	if (PyObject_CheckBuffer(points))
+	{
+		Py_buffer view;
+		if (PyObject_GetBuffer(points, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+		{
+			PyErr_Clear();
+			mvThrowPythonError(mvErrorCode::mvWrongType, "apply_transform_points",
+				"Points buffer must be C contiguous.", nullptr);
+			return GetPyNone();
+		}
+
+		char format = view.format ? view.format[strlen(view.format) - 1] : 'B';
+		if (view.ndim != 2 || view.shape[1] < 2 || view.shape[1] > 4 || (format != 'f' && format != 'd'))
+		{
+			PyBuffer_Release(&view);
+			mvThrowPythonError(mvErrorCode::mvWrongType, "apply_transform_points",
+				"Points buffer must be float32 or float64 with shape (N, 2), (N, 3) or (N, 4).", nullptr);
+			return GetPyNone();
+		}
+
+		const size_t count = (size_t)view.shape[0];
+		const int components = (int)view.shape[1];
+
+		std::vector<float> converted;
+		const float* data = (const float*)view.buf;
+		if (format == 'd')
+		{
+			converted.resize(count * components);
+			const double* source = (const double*)view.buf;
+			for (size_t i = 0; i < converted.size(); i++)
+				converted[i] = (float)source[i];
+			data = converted.data();
+		}
+
+		PyObject* result = PyBytes_FromStringAndSize(nullptr, (Py_ssize_t)(count * sizeof(mvVec4)));
+		if (result == nullptr)
+		{
+			PyBuffer_Release(&view);
+			return nullptr;
+		}
+
+		mvTransformPoints(transform, data, components, components, count, perspectiveDivide, nullptr,
+			(mvVec4*)PyBytes_AS_STRING(result));
+		PyBuffer_Release(&view);
+
+		mvPyObject bytes(result);
+		mvPyObject memory(PyMemoryView_FromObject(result));
+		if (!memory.isOk())
+			return nullptr;
+
+		// memoryview.cast rejects shapes containing 0
+		if (count == 0)
+			return PyObject_CallMethod(memory, "cast", "s", "f");
+		return PyObject_CallMethod(memory, "cast", "s(nn)", "f", (Py_ssize_t)count, (Py_ssize_t)4);
+	}
+
+	std::vector<mvVec4> values = ToVectVec4(points);
+
+	// ToVectVec4 pads missing components with 0
+	if (PySequence_Check(points) && PySequence_Size(points) > 0)
+	{
+		mvPyObject first(PySequence_GetItem(points, 0));
+		if (first.isOk() && PySequence_Check(first) && PySequence_Size(first) < 4)
+		{
+			for (auto& value : values)
+				value.w = 1.0f;
+		}
+	}
+
+	if (!values.empty())
+		mvTransformPoints(transform, &values[0].x, 4, 4, values.size(), perspectiveDivide, nullptr, values.data());
+
+	return ToPyList(values);
+}
+
+static PyObject*
+update_draw_batch(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemraw;
+	int start = 0;
+	PyObject* p1 = nullptr;
+	PyObject* p2 = nullptr;
+	PyObject* p3 = nullptr;
+	PyObject* center = nullptr;
+	PyObject* radii = nullptr;
+	PyObject* thicknesses = nullptr;
+	PyObject* colors = nullptr;
+
+	if (!Parse((GetParsers())["update_draw_batch"], args, kwargs, __FUNCTION__, &itemraw, &start,
+		&p1, &p2, &p3, &center, &radii, &thicknesses, &colors))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	mvUUID item = GetIDFromPyObject(itemraw);
+
+	auto aitem = GetItem((*GContext->itemRegistry), item);
+	if (aitem == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvItemNotFound, "update_draw_batch",
+			"Item not found: " + std::to_string(item), nullptr);
+		return GetPyNone();
+	}
+
+	if (aitem->type != mvAppItemType::mvDrawBatch)
+	{
+		mvThrowPythonError(mvErrorCode::mvIncompatibleType, "update_draw_batch",
+			"Incompatible type. Expected types include: mvDrawBatch", aitem);
+		return GetPyNone();
+	}
+
+	if (start < 0)
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, "update_draw_batch",
+			"start must be positive", aitem);
+		return GetPyNone();
+	}
+
+	static_cast<mvDrawBatch*>(aitem)->updateRange((size_t)start, kwargs);
+
+	return GetPyNone();
+}
+
+static PyObject*
+update_data_table(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemraw;
+	int start = 0;
+	PyObject* columns;
+
+	if (!Parse((GetParsers())["update_data_table"], args, kwargs, __FUNCTION__, &itemraw, &start, &columns))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	mvUUID item = GetIDFromPyObject(itemraw);
+
+	auto aitem = GetItem((*GContext->itemRegistry), item);
+	if (aitem == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvItemNotFound, "update_data_table",
+			"Item not found: " + std::to_string(item), nullptr);
+		return GetPyNone();
+	}
+
+	if (aitem->type != mvAppItemType::mvDataTable)
+	{
+		mvThrowPythonError(mvErrorCode::mvIncompatibleType, "update_data_table",
+			"Incompatible type. Expected types include: mvDataTable", aitem);
+		return GetPyNone();
+	}
+
+	if (start < 0)
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, "update_data_table",
+			"start must be positive", aitem);
+		return GetPyNone();
+	}
+
+	static_cast<mvDataTable*>(aitem)->updateRows((size_t)start, columns);
+
+	return GetPyNone();
+}
+
 static PyObject*
 create_rotation_matrix(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -1948,6 +2132,10 @@ get_viewport_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 		PyDict_SetItemString(pdict, "decorated", mvPyObject(ToPyBool(viewport->decorated)));
 		PyDict_SetItemString(pdict, "title", mvPyObject(ToPyString(viewport->title)));
 		PyDict_SetItemString(pdict, "disable_close", mvPyObject(ToPyBool(viewport->disableClose)));
+		PyDict_SetItemString(pdict, "max_fps", mvPyObject(ToPyFloat(viewport->maxFps)));
+		PyDict_SetItemString(pdict, "min_frame_time", mvPyObject(ToPyFloat(viewport->minFrameTime)));
+		PyDict_SetItemString(pdict, "adaptive_fps", mvPyObject(ToPyBool(viewport->adaptiveFps)));
+		PyDict_SetItemString(pdict, "idle_fps", mvPyObject(ToPyFloat(viewport->idleFps)));
 	}
 	else
 		mvThrowPythonError(mvErrorCode::mvNone, "No viewport created");
@@ -1991,6 +2179,10 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	b32 always_on_top = false;
 	b32 decorated = true;
 	b32 disable_close = false;
+	f32 max_fps = 0.0f;
+	f32 min_frame_time = 0.0f;
+	b32 adaptive_fps = false;
+	f32 idle_fps = 10.0f;
 
 	PyObject* color = PyList_New(4);
 	PyList_SetItem(color, 0, PyFloat_FromDouble(0.0));
@@ -2001,7 +2193,8 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	if (!Parse((GetParsers())["create_viewport"], args, kwargs, __FUNCTION__,
 		&title, &small_icon, &large_icon, &width, &height, &x_pos, &y_pos, &min_width, &max_width, &min_height, &max_height,
-		&resizable, &vsync, &always_on_top, &decorated, &color, &disable_close
+		&resizable, &vsync, &always_on_top, &decorated, &color, &disable_close,
+		&max_fps, &min_frame_time, &adaptive_fps, &idle_fps
 	))
 		return GetPyNone();
 
@@ -2023,6 +2216,10 @@ create_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (PyObject* item = PyDict_GetItemString(kwargs, "decorated")) { viewport->modesDirty = true; viewport->decorated = ToBool(item); }
 	if (PyObject* item = PyDict_GetItemString(kwargs, "title")) { viewport->titleDirty = true; viewport->title = ToString(item); }
 	if (PyObject* item = PyDict_GetItemString(kwargs, "disable_close")) { viewport->modesDirty = true; viewport->disableClose = ToBool(item); }
+	viewport->maxFps = max_fps;
+	viewport->minFrameTime = min_frame_time;
+	viewport->adaptiveFps = adaptive_fps;
+	viewport->idleFps = idle_fps;
 
 	GContext->viewport = viewport;
 
@@ -2076,6 +2273,10 @@ configure_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 		if (PyObject* item = PyDict_GetItemString(kwargs, "decorated")) { viewport->modesDirty = true; viewport->decorated = ToBool(item); }
 		if (PyObject* item = PyDict_GetItemString(kwargs, "title")) { viewport->titleDirty = true; viewport->title = ToString(item); }
 		if (PyObject* item = PyDict_GetItemString(kwargs, "disable_close")) { viewport->modesDirty = true; viewport->disableClose = ToBool(item); }
+		if (PyObject* item = PyDict_GetItemString(kwargs, "max_fps")) viewport->maxFps = ToFloat(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "min_frame_time")) viewport->minFrameTime = ToFloat(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "adaptive_fps")) viewport->adaptiveFps = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "idle_fps")) viewport->idleFps = ToFloat(item);
 
 
 	}
@@ -2178,6 +2379,27 @@ get_frame_count(PyObject* self, PyObject* args, PyObject* kwargs)
 	return ToPyInt(GContext->frame);
 }
 
+static PyObject*
+get_parser_build_times(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	int build_all = false;
+
+	if (!Parse((GetParsers())["get_parser_build_times"], args, kwargs, __FUNCTION__,
+		&build_all))
+		return GetPyNone();
+
+	mvParserRegistry& registry = GetParsers();
+	if (build_all)
+		BuildAllParsers(registry);
+
+	std::lock_guard<std::mutex> lk(registry.mutex);
+	PyObject* pdict = PyDict_New();
+	for (const auto& item : registry.buildTimes)
+		PyDict_SetItemString(pdict, item.first.c_str(), mvPyObject(ToPyDouble(item.second)));
+
+	return pdict;
+}
+
 static PyObject*
 load_image(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -2439,10 +2661,17 @@ render_dearpygui_frame(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	Py_BEGIN_ALLOW_THREADS;
 	auto window = GContext->viewport;
-	mvRenderFrame();
+	if (GContext->inputRecorder.replaying)
+		mvRenderReplayFrame(GContext->inputRecorder);
+	else
+	{
+		mvRenderFrame();
+		if (window)
+			mvPaceFrame(*window);
+	}
 	Py_END_ALLOW_THREADS;
 
-	if (GContext->viewport->resized)
+	if (GContext->viewport && GContext->viewport->resized)
 	{
 		mvOnResize();
 		GContext->viewport->resized = false;
@@ -2451,6 +2680,59 @@ render_dearpygui_frame(PyObject* self, PyObject* args, PyObject* kwargs)
 	return GetPyNone();
 }
 
+static PyObject*
+start_input_recording(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	const char* file;
+
+	if (!Parse((GetParsers())["start_input_recording"], args, kwargs, __FUNCTION__, &file))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+	if (!mvStartInputRecording(GContext->inputRecorder, file))
+		mvThrowPythonError(mvErrorCode::mvNone, "start_input_recording", "Could not open file: " + std::string(file), nullptr);
+
+	return GetPyNone();
+}
+
+static PyObject*
+stop_input_recording(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+	mvStopInputRecording(GContext->inputRecorder);
+	return GetPyNone();
+}
+
+static PyObject*
+start_input_replay(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	const char* file;
+	f32 time_step = 0.0f;
+
+	if (!Parse((GetParsers())["start_input_replay"], args, kwargs, __FUNCTION__, &file, &time_step))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+	if (GContext->viewport == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "start_input_replay", "No viewport created", nullptr);
+		return GetPyNone();
+	}
+
+	if (!mvStartInputReplay(GContext->inputRecorder, file, time_step))
+		mvThrowPythonError(mvErrorCode::mvNone, "start_input_replay", "Could not read input recording: " + std::string(file), nullptr);
+
+	return GetPyNone();
+}
+
+static PyObject*
+stop_input_replay(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+	mvStopInputReplay(GContext->inputRecorder);
+	return ToPyList(GContext->inputRecorder.frameTimes);
+}
+
 static PyObject*
 create_context(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -2531,6 +2813,7 @@ destroy_context(PyObject* self, PyObject* args, PyObject* kwargs)
 			mvGlobalIntepreterLock gil;
 			if (GContext->viewport)
 				delete GContext->viewport;
+			mvStopInputRecording(GContext->inputRecorder);
 			delete GContext->itemRegistry;
 			delete GContext->callbackRegistry;
 			delete GContext;
@@ -2576,6 +2859,42 @@ get_frame_rate(PyObject* self, PyObject* args, PyObject* kwargs)
 
 }
 
+static PyObject*
+get_frame_statistics(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	PyObject* pdict = PyDict_New();
+
+	mvViewport* viewport = GContext->viewport;
+	if (viewport)
+	{
+		const mvFramePacing& pacing = viewport->pacing;
+		f64 total = 0.0;
+		f64 minTime = 0.0;
+		f64 maxTime = 0.0;
+		for (i32 i = 0; i < pacing.frameCount; i++)
+		{
+			f64 frameTime = pacing.frameTimes[i];
+			total += frameTime;
+			if (i == 0 || frameTime < minTime) minTime = frameTime;
+			if (i == 0 || frameTime > maxTime) maxTime = frameTime;
+		}
+		f64 mean = pacing.frameCount > 0 ? total / pacing.frameCount : 0.0;
+
+		PyDict_SetItemString(pdict, "target_frame_time", mvPyObject(ToPyDouble(pacing.targetTime)));
+		PyDict_SetItemString(pdict, "mean", mvPyObject(ToPyDouble(mean)));
+		PyDict_SetItemString(pdict, "min", mvPyObject(ToPyDouble(minTime)));
+		PyDict_SetItemString(pdict, "max", mvPyObject(ToPyDouble(maxTime)));
+		PyDict_SetItemString(pdict, "fps", mvPyObject(ToPyDouble(mean > 0.0 ? 1.0 / mean : 0.0)));
+		PyDict_SetItemString(pdict, "frames", mvPyObject(ToPyInt(pacing.frameCount)));
+	}
+	else
+		mvThrowPythonError(mvErrorCode::mvNone, "No viewport created");
+
+	return pdict;
+}
+
 static PyObject*
 generate_uuid(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -2624,6 +2943,7 @@ configure_app(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (PyObject* item = PyDict_GetItemString(kwargs, "device")) GContext->IO.info_device = ToInt(item);
 
 	if (PyObject* item = PyDict_GetItemString(kwargs, "keyboard_navigation")) GContext->IO.kbdNavigation = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(kwargs, "font_atlas_cache")) GContext->IO.fontAtlasCache = ToString(item);
 
 	return GetPyNone();
 }
@@ -2653,6 +2973,7 @@ get_app_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	PyDict_SetItemString(pdict, "wait_for_input", mvPyObject(ToPyBool(GContext->IO.waitForInput)));
 	PyDict_SetItemString(pdict, "manual_callback_management", mvPyObject(ToPyBool(GContext->IO.manualCallbacks)));
 	PyDict_SetItemString(pdict, "keyboard_navigation", mvPyObject(ToPyBool(GContext->IO.kbdNavigation)));
+	PyDict_SetItemString(pdict, "font_atlas_cache", mvPyObject(ToPyString(GContext->IO.fontAtlasCache)));
 	return pdict;
 }
 
@@ -3131,11 +3452,17 @@ reorder_items(PyObject* self, PyObject* args, PyObject* kwargs)
 	}
 	children = newchildren;
 
+	i32 index = 0;
+	for (auto& child : children)
+		child->info.location = index++;
+
 	if (slot == 1 && parent->type == mvAppItemType::mvTable)
 	{
 		auto pTable = static_cast<mvTable*>(parent);
 		pTable->onChildrenReordered();
 	}
+	else
+		DearPyGui::OnChildrenReordered(parent);
 	return GetPyNone();
 }
 
@@ -3585,6 +3912,7 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 		mvPyObject py_show = ToPyBool(appitem->config.show);
 		mvPyObject py_enabled = ToPyBool(appitem->config.enabled);
 		mvPyObject py_tracked = ToPyBool(appitem->config.tracked);
+		mvPyObject py_track_state = ToPyBool(appitem->config.trackState);
 		mvPyObject py_width = ToPyInt(appitem->config.width);
 		mvPyObject py_track_offset = ToPyFloat(appitem->config.trackOffset);
 		mvPyObject py_height = ToPyInt(appitem->config.height);
@@ -3598,6 +3926,7 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 		PyDict_SetItemString(pdict, "show", py_show);
 		PyDict_SetItemString(pdict, "enabled", py_enabled);
 		PyDict_SetItemString(pdict, "tracked", py_tracked);
+		PyDict_SetItemString(pdict, "track_state", py_track_state);
 		PyDict_SetItemString(pdict, "width", py_width);
 		PyDict_SetItemString(pdict, "track_offset", py_track_offset);
 		PyDict_SetItemString(pdict, "height", py_height);
@@ -3640,6 +3969,567 @@ get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	return pdict;
 }
 
+//-----------------------------------------------------------------------------
+// item tree snapshots
+//
+//     file layout: "DPGT", u32 version, marshal'd record of the root item
+//     record: { "type", "uuid", "alias", "config", "callbacks", "value",
+//               "source", "theme", "font", "handlers", "children" }
+//     "type" is the item's command name ("add_button"), not the enum value
+//     callbacks are stored by __qualname__ and re-bound from a mapping
+//     a failing record fails the whole load, nothing of it is kept
+//
+//     references (source, theme, font, handlers) store the uuid and the
+//     target's alias as "<key>_alias"; targets outside the tree are found
+//     by alias on load and dropped without one, uuids of another session
+//     mean nothing. themes, fonts and handler registries themselves are
+//     not saved.
+//
+//     items are rebuilt by replaying the saved configuration through the
+//     same keyword handling as the add_* commands: no python callables
+//     run, but it is no faster than creating the items from python
+//
+//     clone_item reuses the records in memory (non portable), keeping
+//     callables and values as they are. it goes through the same
+//     configuration replay, the C++ config structs are not copied, so
+//     state that get_item_configuration does not report is not carried
+//     over
+//-----------------------------------------------------------------------------
+
+static const char MV_ITEM_TREE_MAGIC[4] = { 'D', 'P', 'G', 'T' };
+static const u32  MV_ITEM_TREE_VERSION = 2; // 2: types are stored by command name
+
+static bool
+IsMarshalable(PyObject* value)
+{
+	PyObject* bytes = PyMarshal_WriteObjectToString(value, Py_MARSHAL_VERSION);
+	if (bytes == nullptr)
+	{
+		PyErr_Clear();
+		return false;
+	}
+	Py_DECREF(bytes);
+	return true;
+}
+
+static bool
+IsParserArgument(const mvPythonParser& parser, const std::string& name)
+{
+	for (const auto& element : parser.required_elements)
+		if (name == element.name) return true;
+	for (const auto& element : parser.optional_elements)
+		if (name == element.name) return true;
+	for (const auto& element : parser.keyword_elements)
+		if (name == element.name) return true;
+	return false;
+}
+
+static void
+SaveItemRef(PyObject* record, const char* key, mvUUID ref)
+{
+	PyDict_SetItemString(record, key, mvPyObject(ToPyUUID(ref)));
+	mvAppItem* target = GetItem(*GContext->itemRegistry, ref);
+	if (target && !target->config.alias.empty())
+		PyDict_SetItemString(record, (std::string(key) + "_alias").c_str(), mvPyObject(ToPyString(target->config.alias)));
+}
+
+static PyObject*
+SaveItemRecord(mvAppItem& item, bool portable = true)
+{
+	PyObject* record = PyDict_New();
+	PyDict_SetItemString(record, "type", mvPyObject(ToPyString(GetEntityCommand(item.type))));
+	PyDict_SetItemString(record, "uuid", mvPyObject(ToPyUUID(item.uuid)));
+	if (!item.config.alias.empty())
+		PyDict_SetItemString(record, "alias", mvPyObject(ToPyString(item.config.alias)));
+
+	// the configuration as reported by get_item_configuration, limited to
+	// what the constructor accepts and what marshal can store
+	const mvPythonParser& parser = GetParsers()[GetEntityCommand(item.type)];
+	mvPyObject args(Py_BuildValue("(K)", item.uuid));
+	mvPyObject kwargs(PyDict_New());
+	mvPyObject fullConfig(get_item_configuration(nullptr, args, kwargs));
+	if (fullConfig == nullptr || !PyDict_Check(fullConfig))
+		fullConfig = mvPyObject(PyDict_New());
+	PyObject* config = PyDict_New();
+	PyObject* callbacks = PyDict_New();
+	PyObject* key;
+	PyObject* value;
+	Py_ssize_t pos = 0;
+	while (PyDict_Next(fullConfig, &pos, &key, &value))
+	{
+		std::string name = ToString(key);
+		// identity and placement are decided at load time
+		if (name == "source" || name == "tag" || name == "parent" || name == "before" || !IsParserArgument(parser, name))
+			continue;
+
+		if (PyCallable_Check(value) && portable)
+		{
+			if (PyObject* qualname = PyObject_GetAttrString(value, "__qualname__"))
+			{
+				PyDict_SetItem(callbacks, key, qualname);
+				Py_DECREF(qualname);
+			}
+			else
+				PyErr_Clear();
+			continue;
+		}
+
+		if (!portable || IsMarshalable(value))
+			PyDict_SetItem(config, key, value);
+	}
+	PyDict_SetItemString(record, "config", config);
+	PyDict_SetItemString(record, "callbacks", callbacks);
+	Py_DECREF(config);
+	Py_DECREF(callbacks);
+
+	if (item.config.source != 0)
+		SaveItemRef(record, "source", item.config.source);
+
+	// files keep the value of sourced items too, for sources that are dropped on load
+	if (item.config.source == 0 || portable)
+	{
+		mvPyObject itemValue(item.getPyValue());
+		if (itemValue != nullptr && (!portable || IsMarshalable(itemValue)))
+			PyDict_SetItemString(record, "value", itemValue);
+	}
+
+	if (item.theme)
+		SaveItemRef(record, "theme", item.theme->uuid);
+	if (item.font)
+		SaveItemRef(record, "font", item.font->uuid);
+	if (item.handlerRegistry)
+		SaveItemRef(record, "handlers", item.handlerRegistry->uuid);
+
+	PyObject* children = PyList_New(0);
+	for (auto& slot : item.childslots)
+	{
+		for (auto& child : slot)
+			PyList_Append(children, mvPyObject(SaveItemRecord(*child, portable)));
+	}
+	PyDict_SetItemString(record, "children", children);
+	Py_DECREF(children);
+
+	return record;
+}
+
+struct mvItemTreeLoad
+{
+	std::unordered_map<mvUUID, mvUUID>             ids;      // saved -> restored
+	std::vector<std::pair<mvAppItem*, PyObject*>> restored; // records are borrowed from the loaded tree
+	PyObject*                                      callbacks = nullptr;
+
+	// clone_item
+	bool                                           cloning = false;
+	bool                                           shareValues = false; // clones read the original's value
+	std::string                                    aliasPattern;        // "{alias}" and "{n}" are substituted
+	i32                                            index = 0;
+};
+
+static std::string
+FormatCloneAlias(const std::string& pattern, const std::string& alias, i32 index)
+{
+	std::string result = pattern;
+	size_t pos;
+	while ((pos = result.find("{alias}")) != std::string::npos)
+		result.replace(pos, 7, alias);
+	while ((pos = result.find("{n}")) != std::string::npos)
+		result.replace(pos, 3, std::to_string(index));
+	return result;
+}
+
+// item type enum values move between releases, records name the command
+static mvAppItemType
+GetEntityTypeFromCommand(const std::string& command)
+{
+	for (i32 i = (i32)mvAppItemType::All + 1; i < (i32)mvAppItemType::ItemTypeCount; i++)
+	{
+		if (command == GetEntityCommand((mvAppItemType)i))
+			return (mvAppItemType)i;
+	}
+	return mvAppItemType::None;
+}
+
+// returns nullptr with a python error set when the record or any of its
+// children fail, nothing of the subtree is left in the registry then
+static mvAppItem*
+LoadItemRecord(mvItemTreeLoad& load, PyObject* record, mvUUID parent)
+{
+	PyObject* pytype = PyDict_GetItemString(record, "type");
+	PyObject* config = PyDict_GetItemString(record, "config");
+	if (pytype == nullptr || !PyUnicode_Check(pytype) || config == nullptr || !PyDict_Check(config))
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "load_item_tree", "Malformed item record.", nullptr);
+		return nullptr;
+	}
+
+	mvAppItemType type = GetEntityTypeFromCommand(ToString(pytype));
+	if (type == mvAppItemType::None)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "load_item_tree", "Unknown item command: " + ToString(pytype), nullptr);
+		return nullptr;
+	}
+	const char* command = GetEntityCommand(type);
+	const mvPythonParser& parser = GetParsers()[command];
+
+	std::shared_ptr<mvAppItem> item = DearPyGui::CreateEntity(type, GenerateUUID());
+	if (DearPyGui::GetEntityDesciptionFlags(type) & MV_ITEM_DESC_DRAW_CMP)
+		item->drawInfo = std::make_shared<mvAppItemDrawInfo>();
+
+	// positional arguments come from the configuration, data arguments
+	// missing there (series x/y) from the saved value below
+	std::vector<PyObject*> positional;
+	for (const auto& element : parser.required_elements)
+	{
+		if (PyObject* value = PyDict_GetItemString(config, element.name.c_str()))
+			positional.push_back(value);
+		else
+			break;
+	}
+	if (positional.size() == parser.required_elements.size())
+	{
+		for (const auto& element : parser.optional_elements)
+		{
+			if (PyObject* value = PyDict_GetItemString(config, element.name.c_str()))
+				positional.push_back(value);
+			else
+				break;
+		}
+
+		mvPyObject args(PyTuple_New(positional.size()));
+		for (size_t i = 0; i < positional.size(); i++)
+		{
+			Py_INCREF(positional[i]);
+			PyTuple_SetItem(args, i, positional[i]);
+		}
+		item->handleSpecificRequiredArgs(args);
+		item->handleSpecificPositionalArgs(args);
+	}
+
+	mvPyObject kwargs(PyDict_Copy(config));
+	for (const auto& element : parser.required_elements)
+	{
+		if (PyDict_GetItemString(kwargs, element.name.c_str()))
+			PyDict_DelItemString(kwargs, element.name.c_str());
+	}
+	PyObject* callbacks = PyDict_GetItemString(record, "callbacks");
+	if (callbacks && load.callbacks)
+	{
+		PyObject* key;
+		PyObject* name;
+		Py_ssize_t pos = 0;
+		while (PyDict_Next(callbacks, &pos, &key, &name))
+		{
+			if (PyObject* callback = PyDict_GetItem(load.callbacks, name))
+				PyDict_SetItem(kwargs, key, callback);
+		}
+	}
+	item->handleKeywordArgs(kwargs, command);
+	if (PyErr_Occurred())
+		return nullptr;
+
+	if (!AddItemWithRuntimeChecks(*GContext->itemRegistry, item, parent, 0))
+	{
+		if (!PyErr_Occurred())
+			mvThrowPythonError(mvErrorCode::mvNone, command, "Item could not be added.", item.get());
+		return nullptr;
+	}
+
+	// aliases are unique, a second restore of the same tree goes without
+	if (PyObject* alias = PyDict_GetItemString(record, "alias"))
+	{
+		std::string name = ToString(alias);
+		if (load.cloning)
+			name = load.aliasPattern.empty() ? "" : FormatCloneAlias(load.aliasPattern, name, load.index);
+		if (!name.empty() && GetIdFromAlias(*GContext->itemRegistry, name) == 0)
+		{
+			item->config.alias = name;
+			AddAlias(*GContext->itemRegistry, name, item->uuid);
+		}
+	}
+
+	PyObject* uuid = PyDict_GetItemString(record, "uuid");
+	PyObject* value = PyDict_GetItemString(record, "value");
+	if (value && value != Py_None && load.shareValues && uuid)
+		item->setDataSource(ToUUID(uuid));
+	else if (value)
+		item->setPyValue(value);
+
+	if (uuid)
+		load.ids[ToUUID(uuid)] = item->uuid;
+	load.restored.push_back({ item.get(), record });
+
+	if (PyErr_Occurred())
+	{
+		DeleteItem(*GContext->itemRegistry, item->uuid);
+		return nullptr;
+	}
+
+	if (PyObject* children = PyDict_GetItemString(record, "children"))
+	{
+		if (!PyList_Check(children))
+		{
+			DeleteItem(*GContext->itemRegistry, item->uuid);
+			mvThrowPythonError(mvErrorCode::mvWrongType, "load_item_tree", "Malformed item record: children must be a list.", nullptr);
+			return nullptr;
+		}
+
+		for (Py_ssize_t i = 0; i < PyList_Size(children); i++)
+		{
+			if (LoadItemRecord(load, PyList_GetItem(children, i), item->uuid) == nullptr)
+			{
+				DeleteItem(*GContext->itemRegistry, item->uuid);
+				return nullptr;
+			}
+		}
+	}
+
+	return item.get();
+}
+
+// 0 if the reference is missing or can not be resolved
+static mvUUID
+GetRestoredId(mvItemTreeLoad& load, PyObject* record, const char* key)
+{
+	PyObject* saved = PyDict_GetItemString(record, key);
+	if (saved == nullptr)
+		return 0;
+
+	// references into the snapshot are remapped, clones run in the same
+	// session and keep the others, files look them up by alias
+	mvUUID id = ToUUID(saved);
+	auto found = load.ids.find(id);
+	if (found != load.ids.end())
+		return found->second;
+	if (load.cloning)
+		return id;
+	if (PyObject* alias = PyDict_GetItemString(record, (std::string(key) + "_alias").c_str()))
+	{
+		if (PyUnicode_Check(alias))
+			return GetIdFromAlias(*GContext->itemRegistry, ToString(alias));
+	}
+	return 0;
+}
+
+static std::shared_ptr<mvAppItem>
+GetRestoredRef(mvItemTreeLoad& load, PyObject* record, const char* key, mvAppItemType type)
+{
+	mvUUID id = GetRestoredId(load, record, key);
+	if (id == 0)
+		return nullptr;
+
+	// an alias may name an item of another type by now
+	std::shared_ptr<mvAppItem> ref = GetRefItem(*GContext->itemRegistry, id);
+	if (ref == nullptr || ref->type != type)
+		return nullptr;
+	return ref;
+}
+
+static void
+BindRestoredItems(mvItemTreeLoad& load)
+{
+	for (auto& [item, record] : load.restored)
+	{
+		if (mvUUID source = GetRestoredId(load, record, "source"))
+			item->setDataSource(source);
+
+		if (auto theme = GetRestoredRef(load, record, "theme", mvAppItemType::mvTheme))
+			item->theme = *(std::shared_ptr<mvTheme>*)(&theme);
+
+		if (auto font = GetRestoredRef(load, record, "font", mvAppItemType::mvFont))
+			item->font = font;
+
+		if (auto handlers = GetRestoredRef(load, record, "handlers", mvAppItemType::mvItemHandlerRegistry))
+		{
+			item->handlerRegistry = *(std::shared_ptr<mvItemHandlerRegistry>*)(&handlers);
+			item->handlerRegistry->onBind(item);
+		}
+	}
+}
+
+static PyObject*
+save_item_tree(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemraw;
+	const char* file;
+
+	if (!Parse((GetParsers())["save_item_tree"], args, kwargs, __FUNCTION__, &itemraw, &file))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	mvUUID item = GetIDFromPyObject(itemraw);
+	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
+	if (appitem == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvItemNotFound, "save_item_tree",
+			"Item not found: " + std::to_string(item), nullptr);
+		return GetPyNone();
+	}
+
+	mvPyObject record(SaveItemRecord(*appitem));
+	mvPyObject bytes(PyMarshal_WriteObjectToString(record, Py_MARSHAL_VERSION));
+	if (bytes == nullptr)
+	{
+		PyErr_Clear();
+		mvThrowPythonError(mvErrorCode::mvNone, "save_item_tree", "Item tree could not be serialized.", appitem);
+		return GetPyNone();
+	}
+
+	FILE* output = fopen(file, "wb");
+	if (output == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "save_item_tree", "Could not open file: " + std::string(file), appitem);
+		return GetPyNone();
+	}
+	fwrite(MV_ITEM_TREE_MAGIC, 1, 4, output);
+	fwrite(&MV_ITEM_TREE_VERSION, sizeof(u32), 1, output);
+	fwrite(PyBytes_AsString(bytes), 1, PyBytes_Size(bytes), output);
+	fclose(output);
+
+	return GetPyNone();
+}
+
+static PyObject*
+load_item_tree(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	const char* file;
+	PyObject* parentraw = nullptr;
+	PyObject* callbacks = nullptr;
+
+	if (!Parse((GetParsers())["load_item_tree"], args, kwargs, __FUNCTION__, &file, &parentraw, &callbacks))
+		return GetPyNone();
+
+	std::vector<char> data;
+	if (FILE* input = fopen(file, "rb"))
+	{
+		char chunk[4096];
+		size_t count;
+		while ((count = fread(chunk, 1, sizeof(chunk), input)) > 0)
+			data.insert(data.end(), chunk, chunk + count);
+		fclose(input);
+	}
+	else
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "load_item_tree", "Could not open file: " + std::string(file), nullptr);
+		return GetPyNone();
+	}
+
+	u32 version = 0;
+	if (data.size() >= 8)
+		memcpy(&version, data.data() + 4, sizeof(u32));
+	if (data.size() < 8 || memcmp(data.data(), MV_ITEM_TREE_MAGIC, 4) != 0 || version != MV_ITEM_TREE_VERSION)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "load_item_tree", "Not an item tree file: " + std::string(file), nullptr);
+		return GetPyNone();
+	}
+
+	mvPyObject record(PyMarshal_ReadObjectFromString(data.data() + 8, (Py_ssize_t)(data.size() - 8)));
+	if (record == nullptr || !PyDict_Check(record))
+	{
+		PyErr_Clear();
+		mvThrowPythonError(mvErrorCode::mvNone, "load_item_tree", "Corrupt item tree file: " + std::string(file), nullptr);
+		return GetPyNone();
+	}
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	mvItemTreeLoad load;
+	if (callbacks && PyDict_Check(callbacks))
+		load.callbacks = callbacks;
+
+	mvUUID parent = parentraw ? GetIDFromPyObject(parentraw) : 0;
+	mvAppItem* root = LoadItemRecord(load, record, parent);
+	if (root == nullptr)
+		return GetPyNone();
+	BindRestoredItems(load);
+	if (PyErr_Occurred()) // mismatched source types
+	{
+		DeleteItem(*GContext->itemRegistry, root->uuid);
+		return GetPyNone();
+	}
+
+	if (root->config.alias.empty())
+		return ToPyUUID(root->uuid);
+	return ToPyString(root->config.alias);
+}
+
+static PyObject*
+clone_item(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* itemraw;
+	PyObject* parentraw = nullptr;
+	i32 count = 1;
+	b32 shareValues = false;
+	const char* aliasPattern = "";
+
+	if (!Parse((GetParsers())["clone_item"], args, kwargs, __FUNCTION__, &itemraw, &parentraw, &count, &shareValues, &aliasPattern))
+		return GetPyNone();
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	mvUUID item = GetIDFromPyObject(itemraw);
+	mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
+	if (appitem == nullptr)
+	{
+		mvThrowPythonError(mvErrorCode::mvItemNotFound, "clone_item",
+			"Item not found: " + std::to_string(item), nullptr);
+		return GetPyNone();
+	}
+
+	if (count < 1)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "clone_item", "count must be at least 1.", appitem);
+		return GetPyNone();
+	}
+
+	// every copy needs its own alias, later ones would silently go without
+	if (count > 1 && aliasPattern[0] != '\0' && std::string(aliasPattern).find("{n}") == std::string::npos)
+	{
+		mvThrowPythonError(mvErrorCode::mvNone, "clone_item", "alias_pattern must contain '{n}' when count is greater than 1.", appitem);
+		return GetPyNone();
+	}
+
+	mvUUID parent = parentraw ? GetIDFromPyObject(parentraw) : 0;
+	if (parent == 0 && appitem->info.parentPtr)
+		parent = appitem->info.parentPtr->uuid;
+
+	// one record of the subtree, instantiated count times
+	mvPyObject record(SaveItemRecord(*appitem, false));
+
+	std::vector<mvUUID> roots;
+	PyObject* clones = PyList_New(0);
+	for (i32 i = 0; i < count; i++)
+	{
+		mvItemTreeLoad load;
+		load.cloning = true;
+		load.shareValues = shareValues;
+		load.aliasPattern = aliasPattern;
+		load.index = i;
+
+		mvAppItem* root = LoadItemRecord(load, record, parent);
+		if (root)
+		{
+			roots.push_back(root->uuid);
+			BindRestoredItems(load);
+		}
+		if (root == nullptr || PyErr_Occurred())
+		{
+			// all or nothing, earlier clones are removed again
+			for (mvUUID clone : roots)
+				DeleteItem(*GContext->itemRegistry, clone);
+			Py_DECREF(clones);
+			return GetPyNone();
+		}
+
+		if (root->config.alias.empty())
+			PyList_Append(clones, mvPyObject(ToPyUUID(root->uuid)));
+		else
+			PyList_Append(clones, mvPyObject(ToPyString(root->config.alias)));
+	}
+
+	return clones;
+}
+
 static PyObject*
 set_item_children(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -3702,6 +4592,8 @@ set_item_children(PyObject* self, PyObject* args, PyObject* kwargs)
 				index++;
 			}
 		}
+
+		DearPyGui::OnChildrenReordered(appitem);
 	}
 	else
 		mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_item_children",
@@ -3896,6 +4788,130 @@ get_item_state(PyObject* self, PyObject* args, PyObject* kwargs)
 	return pdict;
 }
 
+struct mvItemStateField
+{
+	const char* name;
+	i32         state;                                   // MV_STATE_NONE: always applicable
+	b8        (*flag)(const mvAppItemState&);            // bool column
+	void      (*values)(const mvAppItemState&, f32* out); // float column of 'width' values
+	i32         width;
+};
+
+static const mvItemStateField ItemStateFields[] = {
+	{ "ok",                     MV_STATE_NONE,          [](const mvAppItemState& s) { return s.ok; } },
+	{ "hovered",                MV_STATE_HOVER,         [](const mvAppItemState& s) { return s.hovered; } },
+	{ "active",                 MV_STATE_ACTIVE,        [](const mvAppItemState& s) { return s.active; } },
+	{ "focused",                MV_STATE_FOCUSED,       [](const mvAppItemState& s) { return s.focused; } },
+	{ "clicked",                MV_STATE_CLICKED,       [](const mvAppItemState& s) { return s.leftclicked || s.rightclicked || s.middleclicked; } },
+	{ "left_clicked",           MV_STATE_CLICKED,       [](const mvAppItemState& s) { return s.leftclicked; } },
+	{ "right_clicked",          MV_STATE_CLICKED,       [](const mvAppItemState& s) { return s.rightclicked; } },
+	{ "middle_clicked",         MV_STATE_CLICKED,       [](const mvAppItemState& s) { return s.middleclicked; } },
+	{ "visible",                MV_STATE_VISIBLE,       [](const mvAppItemState& s) { return s.visible; } },
+	{ "edited",                 MV_STATE_EDITED,        [](const mvAppItemState& s) { return s.edited; } },
+	{ "activated",              MV_STATE_ACTIVATED,     [](const mvAppItemState& s) { return s.activated; } },
+	{ "deactivated",            MV_STATE_DEACTIVATED,   [](const mvAppItemState& s) { return s.deactivated; } },
+	{ "deactivated_after_edit", MV_STATE_DEACTIVATEDAE, [](const mvAppItemState& s) { return s.deactivatedAfterEdit; } },
+	{ "toggled_open",           MV_STATE_TOGGLED_OPEN,  [](const mvAppItemState& s) { return s.toggledOpen; } },
+	{ "resized",                MV_STATE_RECT_SIZE,     [](const mvAppItemState& s) { return s.mvRectSizeResized; } },
+	{ "pos",                    MV_STATE_NONE,          nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.pos.x; out[1] = s.pos.y; }, 2 },
+	{ "rect_min",               MV_STATE_RECT_MIN,      nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.rectMin.x; out[1] = s.rectMin.y; }, 2 },
+	{ "rect_max",               MV_STATE_RECT_MAX,      nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.rectMax.x; out[1] = s.rectMax.y; }, 2 },
+	{ "rect_size",              MV_STATE_RECT_SIZE,     nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.rectSize.x; out[1] = s.rectSize.y; }, 2 },
+	{ "content_region_avail",   MV_STATE_CONT_AVAIL,    nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.contextRegionAvail.x; out[1] = s.contextRegionAvail.y; }, 2 },
+	{ "rect",                   MV_STATE_RECT_MIN | MV_STATE_RECT_MAX, nullptr, [](const mvAppItemState& s, f32* out) { out[0] = s.rectMin.x; out[1] = s.rectMin.y; out[2] = s.rectMax.x; out[3] = s.rectMax.y; }, 4 },
+};
+
+static PyObject*
+get_item_states(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+	PyObject* items;
+	PyObject* fields = nullptr;
+
+	if (!Parse((GetParsers())["get_item_states"], args, kwargs, __FUNCTION__, &items, &fields))
+		return GetPyNone();
+
+	std::vector<std::string> names = fields ? ToStringVect(fields) : std::vector<std::string>{ "visible", "rect" };
+
+	// validate every field before any item is touched or marked observed
+	std::vector<const mvItemStateField*> columns;
+	for (const auto& name : names)
+	{
+		const mvItemStateField* field = nullptr;
+		for (const auto& candidate : ItemStateFields)
+		{
+			if (name == candidate.name)
+				field = &candidate;
+		}
+
+		if (field == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "get_item_states", "Unknown state field: " + name, nullptr);
+			return GetPyNone();
+		}
+		columns.push_back(field);
+	}
+
+	std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+
+	auto aitems = ToUUIDVect(items);
+	std::vector<mvAppItem*> resolved(aitems.size());
+	std::vector<i32> applicable(aitems.size());
+	for (size_t i = 0; i < aitems.size(); i++)
+	{
+		resolved[i] = GetItem(*GContext->itemRegistry, aitems[i]);
+		applicable[i] = resolved[i] ? DearPyGui::GetApplicableState(resolved[i]->type) : 0;
+	}
+
+	PyObject* pdict = PyDict_New();
+
+	for (const mvItemStateField* field : columns)
+	{
+		// filled in place, then exposed through a shaped memoryview
+		Py_ssize_t count = (Py_ssize_t)resolved.size();
+		Py_ssize_t itemSize = field->flag ? sizeof(b8) : field->width * sizeof(f32);
+		mvPyObject bytes(PyByteArray_FromStringAndSize(nullptr, count * itemSize));
+		char* data = PyByteArray_AsString(bytes);
+		memset(data, 0, count * itemSize);
+
+		for (size_t i = 0; i < resolved.size(); i++)
+		{
+			mvAppItem* item = resolved[i];
+			if (item == nullptr || (field->state != MV_STATE_NONE && !(applicable[i] & field->state)))
+				continue;
+
+			// the content region is only captured once queried (see GetObservedState)
+			item->state.observed.fetch_or(field->state & applicable[i], std::memory_order_relaxed);
+
+			if (field->flag)
+			{
+				bool valid = field->state == MV_STATE_NONE || item->state.lastFrameUpdate == GContext->frame;
+				((b8*)data)[i] = valid && field->flag(item->state);
+			}
+			else
+				field->values(item->state, (f32*)data + i * field->width);
+		}
+
+		mvPyObject view(PyMemoryView_FromObject(bytes));
+		PyObject* column = nullptr;
+		if (count == 0)
+			column = PyObject_CallMethod(view, "cast", "s", field->flag ? "?" : "f");
+		else if (field->flag)
+			column = PyObject_CallMethod(view, "cast", "s(n)", "?", count);
+		else
+			column = PyObject_CallMethod(view, "cast", "s(nn)", "f", count, (Py_ssize_t)field->width);
+
+		if (column == nullptr)
+		{
+			Py_DECREF(pdict);
+			return GetPyNone();
+		}
+		PyDict_SetItemString(pdict, field->name, column);
+		Py_DECREF(column);
+	}
+
+	return pdict;
+}
+
 static PyObject*
 get_item_types(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -3923,6 +4939,7 @@ configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		//appitem->checkArgs(args, kwargs);
 		appitem->handleKeywordArgs(kwargs, GetEntityCommand(appitem->type));
+		BumpValueVersion((*GContext->itemRegistry), appitem);
 	}
 	else
 		mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_item",
@@ -3987,6 +5004,10 @@ set_value(PyObject* self, PyObject* args, PyObject* kwargs)
 	if (!Parse((GetParsers())["set_value"], args, kwargs, __FUNCTION__, &nameraw, &value))
 		return GetPyNone();
 
+	// scalar values are atomic cells, so they can be stored without the lock
+	if (SetScalarCell(*GContext->itemRegistry, nameraw, value))
+		return GetPyNone();
+
 	if (value)
 		Py_XINCREF(value);
 
@@ -3996,7 +5017,11 @@ set_value(PyObject* self, PyObject* args, PyObject* kwargs)
 
 	mvAppItem* item = GetItem(*GContext->itemRegistry, name);
 	if (item)
+	{
 		item->setPyValue(value);
+		BumpValueVersion(*GContext->itemRegistry, item);
+		CacheScalarCell(*GContext->itemRegistry, item);
+	}
 	else
 	{
 		mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_value",
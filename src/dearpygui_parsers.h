@@ -13,12 +13,12 @@
 #include <utility>
 
 static void
-InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
+InsertParser_Block0(std::map<std::string, mvParserBuilder>& parsers)
 {
 	//-----------------------------------------------------------------------------
 	// callback registry
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "set_frame_callback", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "frame" });
 		args.push_back({ mvPyDataType::Callable, "callback" });
@@ -29,9 +29,8 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::String;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_frame_callback", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	auto standardArgsCallbacks = std::vector<std::pair<std::string, std::string>>{
 		{
@@ -64,23 +63,24 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 
 	for (const auto& item : standardArgsCallbacks)
 	{
-		std::vector<mvPythonDataElement> args;
-		args.push_back({ mvPyDataType::Callable, "callback" });
-		args.push_back({ mvPyDataType::Object, "user_data", mvArgType::KEYWORD_ARG, "None", "New in 1.3. Optional user data to send to the callback" });
+		parsers.insert({ item.first, [item]() {
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::Callable, "callback" });
+			args.push_back({ mvPyDataType::Object, "user_data", mvArgType::KEYWORD_ARG, "None", "New in 1.3. Optional user data to send to the callback" });
 
-		mvPythonParserSetup setup;
-		setup.about = item.second;
-		setup.category = { "General" };
-		setup.returnType = mvPyDataType::String;
+			mvPythonParserSetup setup;
+			setup.about = item.second;
+			setup.category = { "General" };
+			setup.returnType = mvPyDataType::String;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ item.first, parser });
+			return FinalizeParser(setup, args);
+		}});
 	}
 
 	//-----------------------------------------------------------------------------
 	// themes
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "bind_theme", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "theme" });
 
@@ -88,14 +88,13 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Binds a global theme.";
 		setup.category = { "Themes" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "bind_theme", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// tables
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "highlight_table_column", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -106,11 +105,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Highlight specified table column.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "highlight_table_column", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unhighlight_table_column", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "table" });
 		args.push_back({ mvPyDataType::Integer, "column" });
@@ -119,11 +117,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Unhighlight specified table column.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unhighlight_table_column", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_table_row_color", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -134,11 +131,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Set table row color.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_table_row_color", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unset_table_row_color", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "table" });
 		args.push_back({ mvPyDataType::Integer, "row" });
@@ -147,11 +143,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Remove user set table row color.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unset_table_row_color", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "highlight_table_cell", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(4);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -163,11 +158,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Highlight specified table cell.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "highlight_table_cell", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unhighlight_table_cell", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -178,11 +172,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Unhighlight specified table cell.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unhighlight_table_cell", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "highlight_table_row", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -193,11 +186,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Highlight specified table row.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "highlight_table_row", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unhighlight_table_row", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "table" });
 		args.push_back({ mvPyDataType::Integer, "row" });
@@ -206,11 +198,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Unhighlight specified table row.";
 		setup.category = { "Tables", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unhighlight_table_row", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_table_column_highlighted", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "table" });
 		args.push_back({ mvPyDataType::Integer, "column" });
@@ -220,11 +211,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Tables", "App Item Operations" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_table_column_highlighted", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_table_row_highlighted", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "table" });
 		args.push_back({ mvPyDataType::Integer, "row" });
@@ -234,11 +224,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Tables", "App Item Operations" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_table_row_highlighted", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_table_cell_highlighted", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "table" });
@@ -250,14 +239,13 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Tables", "App Item Operations" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_table_cell_highlighted", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// plots
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "is_plot_queried", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "plot" });
 
@@ -266,11 +254,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Plotting", "App Item Operations" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_plot_queried", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_plot_query_area", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "plot" });
 
@@ -279,11 +266,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Plotting", "App Item Operations" };
 		setup.returnType = mvPyDataType::FloatList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_plot_query_area", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_axis_limits", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "axis" });
 
@@ -292,11 +278,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Plotting", "App Item Operations" };
 		setup.returnType = mvPyDataType::FloatList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_axis_limits", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_axis_limits", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "axis" });
@@ -307,11 +292,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets limits on the axis for pan and zoom.";
 		setup.category = { "Plotting", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_axis_limits", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_axis_limits_auto", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "axis" });
 
@@ -319,11 +303,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Removes all limits on specified axis.";
 		setup.category = { "Plotting", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_axis_limits_auto", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "fit_axis_data", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "axis" });
 
@@ -331,11 +314,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets the axis boundaries max/min in the data series currently on the plot.";
 		setup.category = { "Plotting", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "fit_axis_data", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "reset_axis_ticks", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "axis" });
 
@@ -343,11 +325,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Removes the manually set axis ticks and applies the default axis ticks";
 		setup.category = { "Plotting", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "reset_axis_ticks", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_axis_ticks", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "axis" });
 		args.push_back({ mvPyDataType::Object, "label_pairs", mvArgType::REQUIRED_ARG, "...", "Tuples of label and value in the form '((label, axis_value), (label, axis_value), ...)'" });
@@ -356,16 +337,15 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Replaces axis ticks with 'label_pairs' argument.";
 		setup.category = { "Plotting", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_axis_ticks", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// viewport
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "create_viewport", []() {
 		std::vector<mvPythonDataElement> args;
-		args.reserve(16);
+		args.reserve(21);
 		args.push_back({ mvPyDataType::String, "title", mvArgType::KEYWORD_ARG, "'Dear PyGui'", "Sets the title of the viewport." });
 		args.push_back({ mvPyDataType::String, "small_icon", mvArgType::KEYWORD_ARG, "''", "Sets the small icon that is found in the viewport's decorator bar. Must be ***.ico on windows and either ***.ico or ***.png on mac." });
 		args.push_back({ mvPyDataType::String, "large_icon", mvArgType::KEYWORD_ARG, "''", "Sets the large icon that is found in the task bar while the app is running. Must be ***.ico on windows and either ***.ico or ***.png on mac." });
@@ -383,16 +363,19 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		args.push_back({ mvPyDataType::Bool, "decorated", mvArgType::KEYWORD_ARG, "True", "Enabled and disabled the decorator bar at the top of the viewport." });
 		args.push_back({ mvPyDataType::FloatList, "clear_color", mvArgType::KEYWORD_ARG, "(0, 0, 0, 255)", "Sets the color of the back of the viewport." });
 		args.push_back({ mvPyDataType::Bool, "disable_close", mvArgType::KEYWORD_ARG, "False", "Disables the viewport close button. can be used with set_exit_callback" });
+		args.push_back({ mvPyDataType::Float, "max_fps", mvArgType::KEYWORD_ARG, "0.0", "Caps the frame rate of render_dearpygui_frame. 0 is uncapped. Works with or without vsync." });
+		args.push_back({ mvPyDataType::Float, "min_frame_time", mvArgType::KEYWORD_ARG, "0.0", "Minimum time in seconds a frame takes. The stricter of this and max_fps applies." });
+		args.push_back({ mvPyDataType::Bool, "adaptive_fps", mvArgType::KEYWORD_ARG, "False", "Drops to idle_fps while the viewport is unfocused, minimized or has had no input for a second." });
+		args.push_back({ mvPyDataType::Float, "idle_fps", mvArgType::KEYWORD_ARG, "10.0", "Frame rate used by adaptive_fps when idle." });
 
 		mvPythonParserSetup setup;
 		setup.about = "Creates a viewport. Viewports are required.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "create_viewport", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "show_viewport", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Bool, "minimized", mvArgType::KEYWORD_ARG, "False", "Sets the state of the viewport to minimized" });
 		args.push_back({ mvPyDataType::Bool, "maximized", mvArgType::KEYWORD_ARG, "False", "Sets the state of the viewport to maximized" });
@@ -402,11 +385,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Shows the main viewport.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "show_viewport", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "configure_viewport", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -416,11 +398,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.unspecifiedKwargs = true;
 		setup.internal = true;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "configure_viewport", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_viewport_configuration", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -429,11 +410,10 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_viewport_configuration", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_viewport_ok", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -441,51 +421,47 @@ InsertParser_Block0(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_viewport_ok", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "maximize_viewport", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Maximizes the viewport.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "maximize_viewport", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "minimize_viewport", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Minimizes a viewport.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "minimize_viewport", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "toggle_viewport_fullscreen", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Toggle viewport fullscreen mode..";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "toggle_viewport_fullscreen", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 }
 
 static void
-InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
+InsertParser_Block1(std::map<std::string, mvParserBuilder>& parsers)
 {
 	//-----------------------------------------------------------------------------
 	// context
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "get_app_configuration", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -493,11 +469,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_app_configuration", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "configure_app", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(11);
 		args.push_back({ mvPyDataType::Bool, "docking", mvArgType::KEYWORD_ARG, "False", "Enables docking support." });
@@ -515,6 +490,7 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		args.push_back({ mvPyDataType::Bool, "wait_for_input", mvArgType::KEYWORD_ARG, "False", "New in 1.1. Only update when user input occurs" });
 		args.push_back({ mvPyDataType::Bool, "manual_callback_management", mvArgType::KEYWORD_ARG, "False", "New in 1.2"});
 		args.push_back({ mvPyDataType::Bool, "keyboard_navigation", mvArgType::KEYWORD_ARG, "False", "Keyboard navigation using arrow keys" });
+		args.push_back({ mvPyDataType::String, "font_atlas_cache", mvArgType::KEYWORD_ARG, "''", "Existing directory where built font atlases are cached and reloaded without rasterizing the fonts again." });
 
 		mvPythonParserSetup setup;
 		setup.about = "Configures app.";
@@ -522,11 +498,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.unspecifiedKwargs = true;
 		setup.internal = true;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "configure_app", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "save_init_file", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "file" });
 
@@ -534,11 +509,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Save dpg.ini file.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "save_init_file", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "split_frame", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "delay", mvArgType::KEYWORD_ARG, "32", "Minimal delay in in milliseconds" });
 
@@ -546,11 +520,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Waits one frame.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "split_frame", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_frame_count", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -558,11 +531,22 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Integer;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_frame_count", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_parser_build_times", []() {
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::Bool, "build_all", mvArgType::KEYWORD_ARG, "False", "Builds every remaining parser first, giving the full cost an eager import would pay." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns a dictionary of command name to the time in seconds spent building its parser. Parsers are built on first use of each command, so only commands used so far are listed unless build_all is set.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "load_image", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::String, "file" });
@@ -574,11 +558,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Textures", "Utilities" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "load_image", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "save_image", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(5);
 		args.push_back({ mvPyDataType::String, "file" });
@@ -593,11 +576,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Saves an image. Possible formats: png, bmp, tga, hdr, jpg.";
 		setup.category = { "Textures", "Utilities" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "save_image", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "output_frame_buffer", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(1);
 		args.push_back({ mvPyDataType::String, "file", mvArgType::POSITIONAL_ARG, "''"});
@@ -608,11 +590,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Textures", "Utilities" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "output_frame_buffer", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "generate_uuid", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -620,33 +601,30 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "generate_uuid", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "lock_mutex", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Locks render thread mutex.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "lock_mutex", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unlock_mutex", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Unlocks render thread mutex";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unlock_mutex", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_dearpygui_running", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -654,11 +632,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_dearpygui_running", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "setup_dearpygui", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -666,55 +643,94 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 
 		args.push_back({ mvPyDataType::UUID, "viewport", mvArgType::DEPRECATED_REMOVE_KEYWORD_ARG });
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "setup_dearpygui", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "render_dearpygui_frame", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Render a single Dear PyGui frame.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "render_dearpygui_frame", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "start_input_recording", []() {
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::String, "file" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Records the input of every following frame (mouse, keys, wheel, text, viewport size and frame delta) into a binary file until stop_input_recording is called.";
+		setup.category = { "General" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "stop_input_recording", []() {
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Stops recording input and closes the file.";
+		setup.category = { "General" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "start_input_replay", []() {
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::String, "file" });
+		args.push_back({ mvPyDataType::Float, "time_step", mvArgType::KEYWORD_ARG, "0.0", "Fixed frame delta in seconds. 0 uses the recorded deltas." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Replays an input recording without a window system. Each render_dearpygui_frame feeds one recorded frame to Dear PyGui, and is_dearpygui_running turns false after the last one. Requires create_viewport and setup_dearpygui, but not show_viewport. Textures are not created while replaying.";
+		setup.category = { "General" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "stop_input_replay", []() {
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Stops replaying input and returns the time in seconds spent on each replayed frame.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::FloatList;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "destroy_context", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Destroys the Dear PyGui context.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "destroy_context", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "create_context", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Creates the Dear PyGui context.";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "create_context", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "stop_dearpygui", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Stops Dear PyGui";
 		setup.category = { "General" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "stop_dearpygui", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_total_time", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -722,11 +738,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Float;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_total_time", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_delta_time", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -734,11 +749,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Float;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_delta_time", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_frame_rate", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -746,11 +760,21 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Float;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_frame_rate", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_frame_statistics", []() {
+		std::vector<mvPythonDataElement> args;
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns achieved frame time statistics (seconds) across the last 120 paced frames: target_frame_time, mean, min, max, fps and frames.";
+		setup.category = { "General" };
+		setup.returnType = mvPyDataType::Dict;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "get_mouse_pos", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Bool, "local", mvArgType::KEYWORD_ARG, "True" });
 
@@ -759,11 +783,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::IntList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_mouse_pos", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_plot_mouse_pos", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -771,11 +794,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::IntList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_plot_mouse_pos", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_drawing_mouse_pos", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -783,11 +805,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::IntList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_drawing_mouse_pos", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_mouse_drag_delta", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -795,11 +816,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Float;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_mouse_drag_delta", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_mouse_button_dragging", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "button" });
 		args.push_back({ mvPyDataType::Float, "threshold" });
@@ -809,11 +829,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_mouse_button_dragging", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_mouse_button_down", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "button" });
 
@@ -822,11 +841,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_mouse_button_down", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_mouse_button_clicked", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "button" });
 
@@ -835,12 +853,11 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_mouse_button_clicked", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 
-	{
+	parsers.insert({ "is_mouse_button_released", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "button" });
 
@@ -849,11 +866,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_mouse_button_released", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_mouse_button_double_clicked", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "button" });
 
@@ -862,11 +878,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_mouse_button_double_clicked", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_key_pressed", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "key" });
 
@@ -875,11 +890,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_key_pressed", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_key_released", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "key" });
 
@@ -888,11 +902,10 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_key_released", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "is_key_down", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Integer, "key" });
 
@@ -901,15 +914,14 @@ InsertParser_Block1(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Input Polling" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "is_key_down", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 }
 
 static void
-InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
+InsertParser_Block2(std::map<std::string, mvParserBuilder>& parsers)
 {
-	{
+	parsers.insert({ "add_alias", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "alias" });
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -918,11 +930,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Adds an alias.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "add_alias", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "capture_next_item", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::Callable, "callback" });
 		args.push_back({ mvPyDataType::Object, "user_data", mvArgType::KEYWORD_ARG, "None", "New in 1.3. Optional user data to send to the callback" });
@@ -931,12 +942,11 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Captures the next item.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "capture_next_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 
-	{
+	parsers.insert({ "remove_alias", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "alias" });
 
@@ -944,11 +954,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Removes an alias.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "remove_alias", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "does_alias_exist", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "alias" });
 
@@ -957,11 +966,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "does_alias_exist", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_alias_id", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "alias" });
 
@@ -970,44 +978,40 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_alias_id", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "pop_container_stack", []() {
 
 		mvPythonParserSetup setup;
 		setup.about = "Pops the top item off the parent stack and return its ID.";
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, {});
-		parsers.insert({ "pop_container_stack", parser });
-	}
+		return FinalizeParser(setup, {});
+	}});
 
-	{
+	parsers.insert({ "show_imgui_demo", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Shows the imgui demo.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "show_imgui_demo", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "show_implot_demo", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Shows the implot demo.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "show_implot_demo", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "reorder_items", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "container" });
@@ -1018,11 +1022,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Reorders an item's children.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "reorder_items", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "unstage", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1030,11 +1033,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Unstages an item.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "unstage", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "show_item_debug", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1042,11 +1044,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Shows an item's debug window";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "show_item_debug", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "push_container_stack", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1055,11 +1056,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "push_container_stack", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "top_container_stack", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1067,11 +1067,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "top_container_stack", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "last_item", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1079,11 +1078,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "last_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "last_container", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1091,11 +1089,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "last_container", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "last_root", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1103,22 +1100,20 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "last_root", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "empty_container_stack", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
 		setup.about = "Emptyes the container stack.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "empty_container_stack", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "move_item", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -1129,11 +1124,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Moves an item to a new location.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "move_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_windows", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1141,11 +1135,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUIDList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_windows", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_all_items", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1153,11 +1146,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUIDList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_all_items", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_aliases", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1165,11 +1157,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::StringList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_aliases", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "delete_item", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -1180,11 +1171,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Deletes an item..";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "delete_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "does_item_exist", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1193,11 +1183,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::Bool;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "does_item_exist", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "move_item_up", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1205,11 +1194,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Moves an item up.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "move_item_up", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "move_item_down", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1217,11 +1205,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Moves an item down.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "move_item_down", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_active_window", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1229,11 +1216,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_active_window", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_focused_item", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1241,11 +1227,10 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Item Registry" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_focused_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_primary_window", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "window" });
 		args.push_back({ mvPyDataType::Bool, "value" });
@@ -1254,16 +1239,15 @@ InsertParser_Block2(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets the primary window.";
 		setup.category = { "Item Registry" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_primary_window", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 }
 
 static void
-InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
+InsertParser_Block3(std::map<std::string, mvParserBuilder>& parsers)
 {
 
-	{
+	parsers.insert({ "focus_item", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1271,11 +1255,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Focuses an item.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "focus_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_info", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1284,11 +1267,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_item_info", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_configuration", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1297,22 +1279,20 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_item_configuration", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_types", []() {
 
 		mvPythonParserSetup setup;
 		setup.about = "Returns an item types.";
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, {});
-		parsers.insert({ "get_item_types", parser });
-	}
+		return FinalizeParser(setup, {});
+	}});
 
-	{
+	parsers.insert({ "set_item_children", []() {
 		std::vector<mvPythonDataElement> args;
 		args.reserve(3);
 		args.push_back({ mvPyDataType::UUID, "item" });
@@ -1323,11 +1303,55 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets an item's children.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_item_children", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "save_item_tree", []() {
+		std::vector<mvPythonDataElement> args;
+		args.reserve(2);
+		args.push_back({ mvPyDataType::UUID, "item" });
+		args.push_back({ mvPyDataType::String, "file" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Saves an item and its children (types, configuration and values) to a binary file. Callbacks are stored by qualified name. Themes, fonts and handler registries are not saved, only the bindings to them, by alias where the target has one. Loading replays the configuration like the add_* commands, it is not faster than creating the items from Python.";
+		setup.category = { "App Item Operations" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "load_item_tree", []() {
+		std::vector<mvPythonDataElement> args;
+		args.reserve(3);
+		args.push_back({ mvPyDataType::String, "file" });
+		args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "0", "Parent to add the restored tree to." });
+		args.push_back({ mvPyDataType::Dict, "callbacks", mvArgType::KEYWORD_ARG, "None", "Maps saved callback names to callables." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Restores an item tree saved by save_item_tree and returns the new root. Sources and bindings inside the tree are remapped to the restored items, those outside it are looked up by alias and dropped if there is none. Only load files from trusted sources.";
+		setup.category = { "App Item Operations" };
+		setup.returnType = mvPyDataType::UUID;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "clone_item", []() {
+		std::vector<mvPythonDataElement> args;
+		args.reserve(5);
+		args.push_back({ mvPyDataType::UUID, "item" });
+		args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "0", "Parent of the copies, the item's own parent if 0." });
+		args.push_back({ mvPyDataType::Integer, "count", mvArgType::KEYWORD_ARG, "1", "Number of copies." });
+		args.push_back({ mvPyDataType::Bool, "share_values", mvArgType::KEYWORD_ARG, "False", "Copies use the original items as value sources instead of holding their own values." });
+		args.push_back({ mvPyDataType::String, "alias_pattern", mvArgType::KEYWORD_ARG, "''", "Alias for copies of aliased items, '{alias}' and '{n}' (copy index) are substituted; '{n}' is required when count is greater than 1. Copies have no alias if empty." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Copies an item and its children with new uuids. Configuration, callbacks, values and bindings are copied; sources and bindings inside the subtree are remapped to the copies. Copies are created by replaying the configuration as reported by get_item_configuration, state not exposed there is not copied. Returns the new roots.";
+		setup.category = { "App Item Operations" };
+		setup.returnType = mvPyDataType::UUIDList;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "bind_item_font", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::UUID, "font" });
@@ -1336,11 +1360,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets an item's font.";
 		setup.category = { "Fonts", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "bind_item_font", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_item_alias", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::String, "alias" });
@@ -1349,11 +1372,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets an item's alias.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_item_alias", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_alias", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1362,11 +1384,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::String;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_item_alias", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "bind_item_handler_registry", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::UUID, "handler_registry" });
@@ -1375,11 +1396,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Binds an item handler registry to an item.";
 		setup.category = { "App Item Operations", "Events" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "bind_item_handler_registry", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "bind_item_theme", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::UUID, "theme" });
@@ -1388,11 +1408,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Binds a theme to an item.";
 		setup.category = { "App Item Operations", "Themes" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "bind_item_theme", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_state", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1401,11 +1420,23 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_item_state", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_item_states", []() {
+		std::vector<mvPythonDataElement> args;
+		args.push_back({ mvPyDataType::UUIDList, "items" });
+		args.push_back({ mvPyDataType::StringList, "fields", mvArgType::KEYWORD_ARG, "['visible', 'rect']", "State fields to return. Flags (ok, hovered, active, focused, clicked, left_clicked, right_clicked, middle_clicked, visible, edited, activated, deactivated, deactivated_after_edit, toggled_open, resized) are returned as bool buffers of shape (N,). pos, rect_min, rect_max, rect_size and content_region_avail are float buffers of shape (N, 2), rect is (N, 4) as min x, min y, max x, max y." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Returns the state of many items at once as a dict of field name to a buffer with one row per item, e.g. numpy.asarray(states['visible']). Missing items and states not applicable to an item read as false/0.";
+		setup.category = { "App Item Operations" };
+		setup.returnType = mvPyDataType::Dict;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "configure_item", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1415,11 +1446,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.unspecifiedKwargs = true;
 		setup.internal = true;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "configure_item", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_value", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1428,11 +1458,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Any;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_value", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_values", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUIDList, "items" });
 
@@ -1441,11 +1470,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "App Item Operations" };
 		setup.returnType = mvPyDataType::Any;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_values", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_value", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::Object, "value" });
@@ -1454,11 +1482,10 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Set's an item's value.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_value", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "reset_pos", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 
@@ -1466,18 +1493,17 @@ InsertParser_Block3(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Resets an item's position after using 'set_item_pos'.";
 		setup.category = { "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "reset_pos", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 }
 
 static void
-InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
+InsertParser_Block4(std::map<std::string, mvParserBuilder>& parsers)
 {
 	//-----------------------------------------------------------------------------
 	// node editor
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "get_selected_nodes", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "node_editor" });
 
@@ -1486,11 +1512,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Node Editor", "App Item Operations" };
 		setup.returnType = mvPyDataType::UUIDList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_selected_nodes", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_selected_links", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "node_editor" });
 
@@ -1499,11 +1524,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Node Editor", "App Item Operations" };
 		setup.returnType = mvPyDataType::ListStrList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_selected_links", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "clear_selected_links", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "node_editor" });
 
@@ -1511,11 +1535,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Clears a node editor's selected links.";
 		setup.category = { "Node Editor", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "clear_selected_links", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "clear_selected_nodes", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "node_editor" });
 
@@ -1523,14 +1546,13 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Clears a node editor's selected nodes.";
 		setup.category = { "Node Editor", "App Item Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "clear_selected_nodes", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// fonts
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "set_global_font_scale", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::Float, "scale" });
@@ -1539,21 +1561,19 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets global font scale.";
 		setup.category = { "Fonts" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_global_font_scale", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_global_font_scale", []() {
 
 		mvPythonParserSetup setup;
 		setup.about = "Returns global font scale.";
 		setup.category = { "Fonts" };
 		setup.returnType = mvPyDataType::Float;
-		mvPythonParser parser = FinalizeParser(setup, {});
-		parsers.insert({ "get_global_font_scale", parser });
-	}
+		return FinalizeParser(setup, {});
+	}});
 
-	{
+	parsers.insert({ "bind_font", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "font" });
 
@@ -1562,11 +1582,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Fonts" };
 		setup.returnType = mvPyDataType::UUID;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "bind_font", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_text_size", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::String, "text" });
 		args.push_back({ mvPyDataType::Float, "wrap_width", mvArgType::KEYWORD_ARG, "-1.0", "Wrap width to use (-1.0 turns wrap off)." });
@@ -1577,14 +1596,13 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Fonts" };
 		setup.returnType = mvPyDataType::FloatList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_text_size", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// drawings
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "set_clip_space", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "item", mvArgType::REQUIRED_ARG, "", "draw layer to set clip space" });
@@ -1599,12 +1617,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "New in 1.1. Set the clip space for depth clipping and 'viewport' transformation.";
 		setup.category = { "Drawlist", "Widgets" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "set_clip_space", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "apply_transform", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "item", mvArgType::REQUIRED_ARG, "", "Drawing node to apply transform to." });
@@ -1614,12 +1630,59 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "New in 1.1. Applies a transformation matrix to a layer.";
 		setup.category = { "Drawlist", "Matrix Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "apply_transform", parser });
-	}
+	parsers.insert({ "apply_transform_points", []() {
+		std::vector<mvPythonDataElement> args;
 
-	{
+		args.push_back({ mvPyDataType::Object, "matrix", mvArgType::REQUIRED_ARG, "", "Transformation matrix." });
+		args.push_back({ mvPyDataType::Object, "points", mvArgType::REQUIRED_ARG, "", "Nx2, Nx3 or Nx4 points as a float32/float64 buffer (i.e. numpy array) or a list of lists. Missing z and w default to 0 and 1." });
+		args.push_back({ mvPyDataType::Bool, "perspective_divide", mvArgType::KEYWORD_ARG, "False", "Divides x, y and z by w." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Applies a transformation matrix to many points at once. Returns an Nx4 float32 memoryview for buffer input, otherwise a list of lists.";
+		setup.category = { "Drawlist", "Matrix Operations" };
+		setup.returnType = mvPyDataType::Any;
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "update_draw_batch", []() {
+		std::vector<mvPythonDataElement> args;
+
+		args.push_back({ mvPyDataType::UUID, "item", mvArgType::REQUIRED_ARG, "", "Draw batch to update." });
+		args.push_back({ mvPyDataType::Integer, "start", mvArgType::REQUIRED_ARG, "", "First row to overwrite." });
+		args.push_back({ mvPyDataType::Object, "p1", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "p2", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "p3", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "center", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "radii", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "thicknesses", mvArgType::KEYWORD_ARG, "None" });
+		args.push_back({ mvPyDataType::Object, "colors", mvArgType::KEYWORD_ARG, "None" });
+
+		mvPythonParserSetup setup;
+		setup.about = "Overwrites rows of a draw batch's columns starting at 'start'. Copied columns grow as needed, bound buffers must be writable and large enough.";
+		setup.category = { "Drawlist", "Widgets" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "update_data_table", []() {
+		std::vector<mvPythonDataElement> args;
+
+		args.push_back({ mvPyDataType::UUID, "item", mvArgType::REQUIRED_ARG, "", "Data table to update." });
+		args.push_back({ mvPyDataType::Integer, "start", mvArgType::REQUIRED_ARG, "", "First row to overwrite. Columns grow if needed." });
+		args.push_back({ mvPyDataType::Object, "columns", mvArgType::REQUIRED_ARG, "", "New values per column (None leaves a column untouched)." });
+
+		mvPythonParserSetup setup;
+		setup.about = "Overwrites rows of a data table in place.";
+		setup.category = { "Tables", "Widgets" };
+
+		return FinalizeParser(setup, args);
+	}});
+
+	parsers.insert({ "create_rotation_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::Float, "angle", mvArgType::REQUIRED_ARG, "", "angle to rotate" });
@@ -1630,12 +1693,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_rotation_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_scale_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::FloatList, "scales", mvArgType::REQUIRED_ARG, "", "scale values per axis" });
@@ -1645,12 +1706,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_scale_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_translation_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::FloatList, "translation", mvArgType::REQUIRED_ARG, "", "translation vector" });
@@ -1660,12 +1719,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_translation_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_lookat_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::FloatList, "eye", mvArgType::REQUIRED_ARG, "", "eye position" });
@@ -1677,12 +1734,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_lookat_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_perspective_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::Float, "fov", mvArgType::REQUIRED_ARG, "", "Field of view (in radians)" });
@@ -1695,12 +1750,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_perspective_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_orthographic_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::Float, "left", mvArgType::REQUIRED_ARG, "", "left plane" });
@@ -1715,12 +1768,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
+		return FinalizeParser(setup, args);
+	}});
 
-		parsers.insert({ "create_orthographic_matrix", parser });
-	}
-
-	{
+	parsers.insert({ "create_fps_matrix", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::FloatList, "eye", mvArgType::REQUIRED_ARG, "", "eye position" });
@@ -1732,74 +1783,66 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Drawlist", "Matrix Operations" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "create_fps_matrix", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// windows
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "set_x_scroll", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::Float, "value" });
 
 		mvPythonParserSetup setup;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_x_scroll", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_y_scroll", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		args.push_back({ mvPyDataType::Float, "value" });
 		mvPythonParserSetup setup;
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_y_scroll", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_x_scroll", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID , "item" });
 		mvPythonParserSetup setup;
 		setup.returnType = mvPyDataType::Float;
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_x_scroll", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_y_scroll", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		mvPythonParserSetup setup;
 		setup.returnType = mvPyDataType::Float;
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_y_scroll", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_x_scroll_max", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID , "item" });
 		mvPythonParserSetup setup;
 		setup.returnType = mvPyDataType::Float;
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_x_scroll_max", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_y_scroll_max", []() {
 		std::vector<mvPythonDataElement> args;
 		args.push_back({ mvPyDataType::UUID, "item" });
 		mvPythonParserSetup setup;
 		setup.returnType = mvPyDataType::Float;
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_y_scroll_max", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// file dialogs
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "get_file_dialog_info", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "file_dialog" });
@@ -1809,14 +1852,13 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Widgets", "File Dialog" };
 		setup.returnType = mvPyDataType::Dict;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_file_dialog_info", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
 	//-----------------------------------------------------------------------------
 	// color maps
 	//-----------------------------------------------------------------------------
-	{
+	parsers.insert({ "bind_colormap", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "item", mvArgType::REQUIRED_ARG, "", "item that the color map will be applied to" });
@@ -1826,12 +1868,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.about = "Sets the color map for widgets that accept it.";
 		setup.category = { "Widget Operations" };
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "bind_colormap", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "sample_colormap", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "colormap", mvArgType::REQUIRED_ARG, "", "The colormap tag. This should come from a colormap that was added to a colormap registry. Built in color maps are accessible through their corresponding constants mvPlotColormap_Twilight, mvPlotColormap_***" });
@@ -1842,12 +1882,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Widget Operations" };
 		setup.returnType = mvPyDataType::IntList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "sample_colormap", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_colormap_color", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "colormap", mvArgType::REQUIRED_ARG, "", "The colormap tag. This should come from a colormap that was added to a colormap registry. Built in color maps are accessible through their corresponding constants mvPlotColormap_Twilight, mvPlotColormap_***" });
@@ -1858,12 +1896,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Widget Operations" };
 		setup.returnType = mvPyDataType::IntList;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "get_colormap_color", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "show_tool", []() {
 		std::vector<mvPythonDataElement> args;
 
 		args.push_back({ mvPyDataType::UUID, "tool" });
@@ -1873,12 +1909,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "Widgets" };
 		setup.returnType = mvPyDataType::String;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-
-		parsers.insert({ "show_tool", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_callback_queue", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1886,11 +1920,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Object;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_callback_queue", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "set_clipboard_text", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1899,11 +1932,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 
 		args.push_back({ mvPyDataType::String, "text" });
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "set_clipboard_text", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_clipboard_text", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1911,11 +1943,10 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::String;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_clipboard_text", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 
-	{
+	parsers.insert({ "get_platform", []() {
 		std::vector<mvPythonDataElement> args;
 
 		mvPythonParserSetup setup;
@@ -1923,7 +1954,6 @@ InsertParser_Block4(std::map<std::string, mvPythonParser>& parsers)
 		setup.category = { "General" };
 		setup.returnType = mvPyDataType::Integer;
 
-		mvPythonParser parser = FinalizeParser(setup, args);
-		parsers.insert({ "get_platform", parser });
-	}
+		return FinalizeParser(setup, args);
+	}});
 }
\ No newline at end of file
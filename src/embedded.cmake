@@ -32,7 +32,7 @@ if(WIN32)
 	target_link_directories(coreemb PRIVATE "../thirdparty/cpython/PCbuild/amd64/")
 
 	# Add libraries to link to
-	target_link_libraries(coreemb PUBLIC d3d11 dxgi freetype dwmapi $<$<CONFIG:Debug>:python39_d> $<$<CONFIG:Release>:python39>)
+	target_link_libraries(coreemb PUBLIC d3d11 dxgi freetype dwmapi winmm $<$<CONFIG:Debug>:python39_d> $<$<CONFIG:Release>:python39>)
 	
 ###############################################################################
 # Apple Specifics
@@ -119,7 +119,14 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
             info.hiddenLastFrame = true;
     }
 
-    if (PyObject* item = PyDict_GetItemString(dict, "filter_key")) config.filter = ToString(item);
+    if (PyObject* item = PyDict_GetItemString(dict, "filter_key"))
+    {
+        config.filter = ToString(item);
+
+        // filter sets cache the pass/fail result of their children
+        if (info.parentPtr && info.parentPtr->type == mvAppItemType::mvFilterSet)
+            static_cast<mvFilterSet*>(info.parentPtr)->configData.dirty = true;
+    }
     if (PyObject* item = PyDict_GetItemString(dict, "payload_type")) config.payloadType = ToString(item);
     if (PyObject* item = PyDict_GetItemString(dict, "source"))
     {
@@ -130,6 +137,9 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
             std::string alias = ToString(item);
             setDataSource(GetIdFromAlias(*GContext->itemRegistry, alias));
         }
+
+        // the value cell may have been swapped for the source's
+        ForgetScalarCell(*GContext->itemRegistry, uuid);
     }
     if (PyObject* item = PyDict_GetItemString(dict, "enabled"))
     {
@@ -146,6 +156,7 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
         }
     }
     if (PyObject* item = PyDict_GetItemString(dict, "tracked")) config.tracked = ToBool(item);
+    if (PyObject* item = PyDict_GetItemString(dict, "track_state")) config.trackState = ToBool(item);
     if (PyObject* item = PyDict_GetItemString(dict, "delay_search")) config.searchLast = ToBool(item);
     if (PyObject* item = PyDict_GetItemString(dict, "track_offset"))
     {
@@ -160,6 +171,13 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
     if (PyObject* item = PyDict_GetItemString(dict, "callback"))
     {
         config.callback = mvPyObjectStrict(item);
+        config.nativeCallback = nullptr;
+        config.nativeUserData = nullptr;
+        if (PyCapsule_IsValid(item, MV_NATIVE_CALLBACK_CAPSULE))
+        {
+            config.nativeCallback = reinterpret_cast<mvNativeCallback>(PyCapsule_GetPointer(item, MV_NATIVE_CALLBACK_CAPSULE));
+            config.nativeUserData = PyCapsule_GetContext(item);
+        }
     }
 
     if (PyObject* item = PyDict_GetItemString(dict, "drag_callback"))
@@ -178,6 +196,10 @@ mvAppItem::handleKeywordArgs(PyObject* dict, const std::string& parser)
     }
 
     handleSpecificKeywordArgs(dict);
+
+    // handler registries dispatch by key/button
+    if (info.parentPtr && info.parentPtr->type == mvAppItemType::mvHandlerRegistry)
+        static_cast<mvHandlerRegistry*>(info.parentPtr)->onChildrenRemoved();
 }
 
 void 
@@ -461,6 +483,7 @@ CanItemTypeBeVisible(mvAppItemType type)
     case mvAppItemType::mvNodeEditor:
     case mvAppItemType::mvPlot:
     case mvAppItemType::mvTable:
+    case mvAppItemType::mvDataTable:
     case mvAppItemType::mvTableColumn:
     case mvAppItemType::mvTableRow:
     case mvAppItemType::mvButton: return true;
@@ -881,6 +904,7 @@ DearPyGui::GetEntityDesciptionFlags(mvAppItemType type)
     case mvAppItemType::mvDrawRect:
     case mvAppItemType::mvDrawText:
     case mvAppItemType::mvDrawTriangle:
+    case mvAppItemType::mvDrawBatch:
     case mvAppItemType::mvDrawArrow: return MV_ITEM_DESC_DRAW_CMP;
 
     case mvAppItemType::mvDrawNode:
@@ -990,6 +1014,7 @@ DearPyGui::GetEntityTargetSlot(mvAppItemType type)
     case mvAppItemType::mvDrawRect:
     case mvAppItemType::mvDrawText:
     case mvAppItemType::mvDrawTriangle:
+    case mvAppItemType::mvDrawBatch:
     case mvAppItemType::mvDrawArrow: return 2;
 
     case mvAppItemType::mvDragPayload: return 3;
@@ -1222,6 +1247,7 @@ DearPyGui::GetAllowableParents(mvAppItemType type)
     case mvAppItemType::mvDrawRect:
     case mvAppItemType::mvDrawText:
     case mvAppItemType::mvDrawTriangle:
+    case mvAppItemType::mvDrawBatch:
     case mvAppItemType::mvDrawArrow:
         MV_START_PARENTS
         MV_ADD_PARENT(mvAppItemType::mvStage),
@@ -1533,6 +1559,7 @@ DearPyGui::GetAllowableChildren(mvAppItemType type)
         MV_ADD_CHILD(mvAppItemType::mvDrawText),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolygon),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolyline),
+        MV_ADD_CHILD(mvAppItemType::mvDrawBatch),
         MV_ADD_CHILD(mvAppItemType::mvDrawImage),
         MV_ADD_CHILD(mvAppItemType::mvDrawLayer),
         MV_ADD_CHILD(mvAppItemType::mvActivatedHandler),
@@ -1625,6 +1652,7 @@ DearPyGui::GetAllowableChildren(mvAppItemType type)
         MV_ADD_CHILD(mvAppItemType::mvDrawText),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolygon),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolyline),
+        MV_ADD_CHILD(mvAppItemType::mvDrawBatch),
         MV_ADD_CHILD(mvAppItemType::mvDrawImageQuad),
         MV_ADD_CHILD(mvAppItemType::mvDrawImage),
         MV_ADD_CHILD(mvAppItemType::mvDrawNode),
@@ -1645,6 +1673,7 @@ DearPyGui::GetAllowableChildren(mvAppItemType type)
         MV_ADD_CHILD(mvAppItemType::mvDrawText),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolygon),
         MV_ADD_CHILD(mvAppItemType::mvDrawPolyline),
+        MV_ADD_CHILD(mvAppItemType::mvDrawBatch),
         MV_ADD_CHILD(mvAppItemType::mvDrawImage),
         MV_ADD_CHILD(mvAppItemType::mvDrawImageQuad),
         MV_ADD_CHILD(mvAppItemType::mvDrawNode),
@@ -1800,12 +1829,15 @@ DearPyGui::GetEntityParser(mvAppItemType type)
             MV_PARSER_ARG_POS)
         );
 
-        args.push_back({ mvPyDataType::StringList, "items", mvArgType::POSITIONAL_ARG, "()", "A tuple of items to be shown in the drop down window. Can consist of any combination of types but will convert all items to strings to be shown." });
+        args.push_back({ mvPyDataType::StringListOrBuffer, "items", mvArgType::POSITIONAL_ARG, "()", "A tuple of items to be shown in the drop down window. Can consist of any combination of types but will convert all items to strings to be shown. A numpy string array or newline separated bytes are also accepted." });
         args.push_back({ mvPyDataType::String, "default_value", mvArgType::KEYWORD_ARG, "''", "Sets a selected item from the drop down by specifying the string value." });
         args.push_back({ mvPyDataType::Bool, "popup_align_left", mvArgType::KEYWORD_ARG, "False", "Align the contents on the popup toward the left." });
         args.push_back({ mvPyDataType::Bool, "no_arrow_button", mvArgType::KEYWORD_ARG, "False", "Display the preview box without the square arrow button indicating dropdown activity." });
         args.push_back({ mvPyDataType::Bool, "no_preview", mvArgType::KEYWORD_ARG, "False", "Display only the square arrow button and not the selected value." });
         args.push_back({ mvPyDataType::Long, "height_mode", mvArgType::KEYWORD_ARG, "1", "Controlls the number of items shown in the dropdown by the constants mvComboHeight_Small, mvComboHeight_Regular, mvComboHeight_Large, mvComboHeight_Largest" });
+        args.push_back({ mvPyDataType::String, "filter", mvArgType::KEYWORD_ARG, "''", "Case-insensitive text used to filter the items shown in the dropdown." });
+        args.push_back({ mvPyDataType::Integer, "filter_mode", mvArgType::KEYWORD_ARG, "0", "Filter matching by the constants mvItemFilter_Substring, mvItemFilter_Prefix, mvItemFilter_Fuzzy" });
+        args.push_back({ mvPyDataType::Bool, "show_filter", mvArgType::KEYWORD_ARG, "False", "Shows a filter input at the top of the dropdown." });
 
         setup.about = "Adds a combo dropdown that allows a user to select a single option from a drop down window. All items will be shown as selectables on the dropdown.";
         break;
@@ -2192,6 +2224,8 @@ DearPyGui::GetEntityParser(mvAppItemType type)
             MV_PARSER_ARG_SHOW)
         );
 
+        args.push_back({ mvPyDataType::Bool, "indexed", mvArgType::KEYWORD_ARG, "False", "Builds a trigram index over the children's filter keys so new filters are resolved without testing every child. Useful for very large sets." });
+
         setup.about = "Helper to parse and apply text filters (e.g. aaaaa[, bbbbb][, ccccc])";
         setup.category = { "Containers", "Widgets" };
         setup.createContextManager = true;
@@ -2568,9 +2602,12 @@ DearPyGui::GetEntityParser(mvAppItemType type)
             MV_PARSER_ARG_POS)
         );
 
-        args.push_back({ mvPyDataType::StringList, "items", mvArgType::POSITIONAL_ARG, "()", "A tuple of items to be shown in the listbox. Can consist of any combination of types. All items will be displayed as strings." });
+        args.push_back({ mvPyDataType::StringListOrBuffer, "items", mvArgType::POSITIONAL_ARG, "()", "A tuple of items to be shown in the listbox. Can consist of any combination of types. All items will be displayed as strings. A numpy string array or newline separated bytes are also accepted." });
         args.push_back({ mvPyDataType::String, "default_value", mvArgType::KEYWORD_ARG, "''", "String value of the item that will be selected by default." });
         args.push_back({ mvPyDataType::Integer, "num_items", mvArgType::KEYWORD_ARG, "3", "Expands the height of the listbox to show specified number of items." });
+        args.push_back({ mvPyDataType::String, "filter", mvArgType::KEYWORD_ARG, "''", "Case-insensitive text used to filter the items shown in the listbox." });
+        args.push_back({ mvPyDataType::Integer, "filter_mode", mvArgType::KEYWORD_ARG, "0", "Filter matching by the constants mvItemFilter_Substring, mvItemFilter_Prefix, mvItemFilter_Fuzzy" });
+        args.push_back({ mvPyDataType::Bool, "show_filter", mvArgType::KEYWORD_ARG, "False", "Shows a filter input above the listbox." });
 
 
         setup.about = "Adds a listbox. If height is not large enough to show all items a scroll bar will appear.";
@@ -3129,12 +3166,50 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::Bool, "scrollX", mvArgType::KEYWORD_ARG, "False", "Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX." });
         args.push_back({ mvPyDataType::Bool, "scrollY", mvArgType::KEYWORD_ARG, "False", "Enable vertical scrolling." });
         args.push_back({ mvPyDataType::Bool, "no_saved_settings", mvArgType::KEYWORD_ARG, "False", "Never load/save settings in .ini file." });
+        args.push_back({ mvPyDataType::Bool, "native_sort", mvArgType::KEYWORD_ARG, "False", "Sort rows in C++ when the sort specs change (stable, multi column) using sort_keys of the columns or the cell values. Rows are drawn in sorted order without being moved; the callback is still sent." });
 
         setup.about = "Adds a table.";
         setup.category = { "Tables", "Containers", "Widgets" };
         setup.createContextManager = true;
         break;
     }
+    case mvAppItemType::mvDataTable:
+    {
+        AddCommonArgs(args, (CommonParserArgs)(
+            MV_PARSER_ARG_ID |
+            MV_PARSER_ARG_WIDTH |
+            MV_PARSER_ARG_HEIGHT |
+            MV_PARSER_ARG_INDENT |
+            MV_PARSER_ARG_PARENT |
+            MV_PARSER_ARG_BEFORE |
+            MV_PARSER_ARG_CALLBACK |
+            MV_PARSER_ARG_SHOW |
+            MV_PARSER_ARG_POS)
+        );
+
+        args.push_back({ mvPyDataType::Object, "columns", mvArgType::KEYWORD_ARG, "[]", "Column data. Each column is a numeric buffer (i.e. numpy array), a list of numbers or a list of strings." });
+        args.push_back({ mvPyDataType::StringList, "headers", mvArgType::KEYWORD_ARG, "[]", "Column headers." });
+        args.push_back({ mvPyDataType::Object, "formats", mvArgType::KEYWORD_ARG, "[]", "Per column printf style format (i.e. '%.3f') or a list of formats, one per cell. Must take a single argument matching the column type (length modifiers such as '%ld' are accepted), other formats raise." });
+        args.push_back({ mvPyDataType::IntList, "highlighted", mvArgType::KEYWORD_ARG, "[]", "Rows drawn with highlight_color." });
+        args.push_back({ mvPyDataType::IntList, "highlight_color", mvArgType::KEYWORD_ARG, "(66, 150, 250, 89)" });
+        args.push_back({ mvPyDataType::Bool, "header_row", mvArgType::KEYWORD_ARG, "True", "show headers at the top of the columns" });
+        args.push_back({ mvPyDataType::Bool, "selectable", mvArgType::KEYWORD_ARG, "True", "Rows can be selected (ctrl/shift for multiple). The callback receives the clicked row, the value is the list of selected rows." });
+        args.push_back({ mvPyDataType::Bool, "resizable", mvArgType::KEYWORD_ARG, "False", "Enable resizing columns" });
+        args.push_back({ mvPyDataType::Bool, "reorderable", mvArgType::KEYWORD_ARG, "False", "Enable reordering columns in header row" });
+        args.push_back({ mvPyDataType::Bool, "hideable", mvArgType::KEYWORD_ARG, "False", "Enable hiding/disabling columns in context menu." });
+        args.push_back({ mvPyDataType::Bool, "row_background", mvArgType::KEYWORD_ARG, "True", "Set each RowBg color with ImGuiCol_TableRowBg or ImGuiCol_TableRowBgAlt" });
+        args.push_back({ mvPyDataType::Bool, "borders_innerH", mvArgType::KEYWORD_ARG, "False", "Draw horizontal borders between rows." });
+        args.push_back({ mvPyDataType::Bool, "borders_outerH", mvArgType::KEYWORD_ARG, "False", "Draw horizontal borders at the top and bottom." });
+        args.push_back({ mvPyDataType::Bool, "borders_innerV", mvArgType::KEYWORD_ARG, "False", "Draw vertical borders between columns." });
+        args.push_back({ mvPyDataType::Bool, "borders_outerV", mvArgType::KEYWORD_ARG, "False", "Draw vertical borders on the left and right sides." });
+        args.push_back({ mvPyDataType::Bool, "scrollX", mvArgType::KEYWORD_ARG, "False", "Enable horizontal scrolling." });
+        args.push_back({ mvPyDataType::Bool, "scrollY", mvArgType::KEYWORD_ARG, "True", "Enable vertical scrolling." });
+        args.push_back({ mvPyDataType::Bool, "no_saved_settings", mvArgType::KEYWORD_ARG, "False", "Never load/save settings in .ini file." });
+
+        setup.about = "Adds a table drawn directly from column data. Only visible rows are formatted, so it scales to very large row counts. Use update_data_table to change rows in place.";
+        setup.category = { "Tables", "Widgets" };
+        break;
+    }
     case mvAppItemType::mvTableColumn:                 
     {
         AddCommonArgs(args, (CommonParserArgs)(
@@ -3163,6 +3238,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::Bool, "prefer_sort_descending", mvArgType::KEYWORD_ARG, "False", "Make the initial sort direction Descending when first sorting on this column." });
         args.push_back({ mvPyDataType::Bool, "indent_enable", mvArgType::KEYWORD_ARG, "False", "Use current Indent value when entering cell (default for column 0)." });
         args.push_back({ mvPyDataType::Bool, "indent_disable", mvArgType::KEYWORD_ARG, "False", "Ignore current Indent value when entering cell (default for columns > 0). Indentation changes _within_ the cell will still be honored." });
+        args.push_back({ mvPyDataType::Object, "sort_keys", mvArgType::KEYWORD_ARG, "None", "Numbers or strings, one per row, used by native_sort instead of the cell values." });
 
         setup.about = "Adds a table column.";
         setup.category = { "Tables", "Widgets" };
@@ -3220,6 +3296,34 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         setup.category = { "Drawlist", "Widgets" };
         break;
     }
+    case mvAppItemType::mvDrawBatch:
+    {
+        AddCommonArgs(args, (CommonParserArgs)(
+            MV_PARSER_ARG_ID |
+            MV_PARSER_ARG_PARENT |
+            MV_PARSER_ARG_BEFORE |
+            MV_PARSER_ARG_SHOW)
+        );
+
+        args.push_back({ mvPyDataType::Integer, "kind", mvArgType::KEYWORD_ARG, "0", "mvDrawBatch_Lines, mvDrawBatch_Circles, mvDrawBatch_Rects, mvDrawBatch_Triangles or mvDrawBatch_Points" });
+        args.push_back({ mvPyDataType::Object, "p1", mvArgType::KEYWORD_ARG, "None", "Nx2 or Nx3 column of line starts, rect minimums, first triangle vertices or centers. float32 buffers are drawn without copying." });
+        args.push_back({ mvPyDataType::Object, "p2", mvArgType::KEYWORD_ARG, "None", "Nx2 or Nx3 column of line ends, rect maximums or second triangle vertices." });
+        args.push_back({ mvPyDataType::Object, "p3", mvArgType::KEYWORD_ARG, "None", "Nx2 or Nx3 column of third triangle vertices." });
+        args.push_back({ mvPyDataType::Object, "center", mvArgType::KEYWORD_ARG, "None", "Same column as p1, for circles and points." });
+        args.push_back({ mvPyDataType::Object, "radii", mvArgType::KEYWORD_ARG, "None", "Per primitive radius for circles and points (points are squares of this half size)." });
+        args.push_back({ mvPyDataType::Object, "thicknesses", mvArgType::KEYWORD_ARG, "None", "Per primitive thickness." });
+        args.push_back({ mvPyDataType::Object, "colors", mvArgType::KEYWORD_ARG, "None", "Per primitive color, either packed uint32 or Nx4 in 0-255." });
+        args.push_back({ mvPyDataType::IntList, "color", mvArgType::KEYWORD_ARG, "(255, 255, 255, 255)", "Used when colors is not set." });
+        args.push_back({ mvPyDataType::Float, "radius", mvArgType::KEYWORD_ARG, "1.0", "Used when radii is not set." });
+        args.push_back({ mvPyDataType::Float, "thickness", mvArgType::KEYWORD_ARG, "1.0", "Used when thicknesses is not set." });
+        args.push_back({ mvPyDataType::Bool, "fill", mvArgType::KEYWORD_ARG, "False", "Fills circles, rects and triangles with their color." });
+        args.push_back({ mvPyDataType::Integer, "segments", mvArgType::KEYWORD_ARG, "0", "Number of segments to approximate circles." });
+        args.push_back({ mvPyDataType::Integer, "count", mvArgType::KEYWORD_ARG, "-1", "Number of rows to draw, -1 draws every row." });
+
+        setup.about = "Adds a batch of primitives stored as columns. Use update_draw_batch to overwrite a range of rows.";
+        setup.category = { "Drawlist", "Widgets" };
+        break;
+    }
     case mvAppItemType::mvDrawTriangle:                
     {
         AddCommonArgs(args, (CommonParserArgs)(
@@ -3844,6 +3948,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
 
         args.push_back({ mvPyDataType::DoubleList, "x" });
         args.push_back({ mvPyDataType::DoubleList, "y" });
+        args.push_back({ mvPyDataType::Integer, "density_threshold", mvArgType::KEYWORD_ARG, "0", "Above this many points, only one marker is drawn per occupied marker-sized cell of the plot area. Cells are rebinned on a worker thread when the limits or data change. 0 disables."});
 
         setup.about = "Adds a scatter series to a plot.";
         setup.category = { "Plotting", "Containers", "Widgets" };
@@ -3975,6 +4080,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::DoubleList, "bounds_max", mvArgType::KEYWORD_ARG, "(1.0, 1.0)" });
         args.push_back({ mvPyDataType::String, "format", mvArgType::KEYWORD_ARG, "'%0.1f'" });
         args.push_back({ mvPyDataType::Bool, "contribute_to_bounds", mvArgType::KEYWORD_ARG, "True" });
+        args.push_back({ mvPyDataType::Bool, "texture", mvArgType::KEYWORD_ARG, "False", "Colormaps the values into a single texture instead of drawing a rect per cell. Large series are downsampled to screen resolution, only changed cells are re-uploaded and format is ignored." });
 
         setup.about = "Adds a heat series to a plot.";
         setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4081,6 +4187,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::Bool, "density", mvArgType::KEYWORD_ARG, "False" });
         args.push_back({ mvPyDataType::Bool, "outliers", mvArgType::KEYWORD_ARG, "True" });
         args.push_back({ mvPyDataType::Bool, "contribute_to_bounds", mvArgType::KEYWORD_ARG, "True" });
+        args.push_back({ mvPyDataType::Bool, "streaming", mvArgType::KEYWORD_ARG, "False", "Samples are only ever appended to x. With fixed bins and range, new samples are added to the cached bin counts instead of rebinning everything." });
 
         setup.about = "Adds a histogram series to a plot.";
         setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4106,6 +4213,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::Double, "ymax_range", mvArgType::KEYWORD_ARG, "1.0" });
         args.push_back({ mvPyDataType::Bool, "density", mvArgType::KEYWORD_ARG, "False" });
         args.push_back({ mvPyDataType::Bool, "outliers", mvArgType::KEYWORD_ARG, "True" });
+        args.push_back({ mvPyDataType::Bool, "streaming", mvArgType::KEYWORD_ARG, "False", "Samples are only ever appended to x and y. With fixed bins and ranges, new samples are added to the cached bin counts instead of rebinning everything." });
 
         setup.about = "Adds a 2d histogram series.";
         setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4131,6 +4239,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::Float, "weight", mvArgType::KEYWORD_ARG, "0.25" });
         args.push_back({ mvPyDataType::Bool, "tooltip", mvArgType::KEYWORD_ARG, "True" });
         args.push_back({ mvPyDataType::Integer, "time_unit", mvArgType::KEYWORD_ARG, "5", "mvTimeUnit_* constants. Default mvTimeUnit_Day."});
+        args.push_back({ mvPyDataType::Float, "min_candle_width", mvArgType::KEYWORD_ARG, "0.0", "Merges candles into wider time buckets so bodies stay at least this many pixels wide when zoomed out. 0 disables merging."});
 
         setup.about = "Adds a candle series to a plot.";
         setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4800,6 +4909,7 @@ DearPyGui::GetEntityParser(mvAppItemType type)
         args.push_back({ mvPyDataType::String, "file" });
         args.push_back({ mvPyDataType::Integer, "size" });
         args.push_back({ mvPyDataType::Bool, "pixel_snapH", mvArgType::KEYWORD_ARG, "False", "Align every glyph to pixel boundary. Useful e.g. if you are merging a non-pixel aligned font with the default font, or rendering text piece-by-piece (e.g. for coloring)." });
+        args.push_back({ mvPyDataType::Bool, "dynamic", mvArgType::KEYWORD_ARG, "False", "Only the default ranges and range hints are rasterized up front. Glyphs of font ranges and chars are rasterized on a worker thread when they are first used in text and added to the atlas on a following frame." });
         args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "internal_dpg.mvReservedUUID_0", "Parent to add this item to. (runtime adding)" });
         args.push_back({ mvPyDataType::Bool, "default_font", mvArgType::DEPRECATED_REMOVE_KEYWORD_ARG });
 
@@ -5279,6 +5389,9 @@ DearPyGui::GetEntityParser(mvAppItemType type)
     default: break;
     }
 
+    if (GetApplicableState(type) & ~MV_STATE_ALWAYS_CAPTURED)
+        args.push_back({ mvPyDataType::Bool, "track_state", mvArgType::KEYWORD_ARG, "False", "Also captures content_region_avail every frame. By default it is only captured once it has been queried, so its first query reports it unset." });
+
     return FinalizeParser(setup, args);
 }
 
@@ -5331,6 +5444,20 @@ DearPyGui::OnChildAdded(mvAppItem* item, std::shared_ptr<mvAppItem> child)
             return;
         }
 
+        case mvAppItemType::mvFilterSet:
+        {
+            mvFilterSet* actualItem = (mvFilterSet*)item;
+            actualItem->onChildAdd(child);
+            return;
+        }
+
+        case mvAppItemType::mvHandlerRegistry:
+        {
+            mvHandlerRegistry* actualItem = (mvHandlerRegistry*)item;
+            actualItem->onChildAdd(child);
+            return;
+        }
+
         default: return;
     }
 }
@@ -5380,6 +5507,46 @@ DearPyGui::OnChildRemoved(mvAppItem* item, std::shared_ptr<mvAppItem> child)
             return;
         }
 
+        case mvAppItemType::mvFilterSet:
+        {
+            mvFilterSet* actualItem = (mvFilterSet*)item;
+            actualItem->onChildRemoved(child);
+            return;
+        }
+
+        case mvAppItemType::mvHandlerRegistry:
+        {
+            mvHandlerRegistry* actualItem = (mvHandlerRegistry*)item;
+            actualItem->onChildRemoved(child);
+            return;
+        }
+
+        default:
+            return;
+    }
+}
+
+void
+DearPyGui::OnChildrenReordered(mvAppItem* item)
+{
+    // items caching raw child pointers rebuild from childslots
+    switch (item->type)
+    {
+
+        case mvAppItemType::mvFilterSet:
+        {
+            mvFilterSet* actualItem = (mvFilterSet*)item;
+            actualItem->onChildrenRemoved();
+            return;
+        }
+
+        case mvAppItemType::mvHandlerRegistry:
+        {
+            mvHandlerRegistry* actualItem = (mvHandlerRegistry*)item;
+            actualItem->onChildrenRemoved();
+            return;
+        }
+
         default:
             return;
     }
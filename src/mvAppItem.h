@@ -11,6 +11,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <atomic>
 #include <imgui.h>
 #include "mvAppItemState.h"
 #include "mvCallbackRegistry.h"
@@ -85,6 +86,7 @@ namespace DearPyGui
     mvPythonParser                                  GetEntityParser                 (mvAppItemType type);
     void                                            OnChildAdded                    (mvAppItem* item, std::shared_ptr<mvAppItem> child);
     void                                            OnChildRemoved                  (mvAppItem* item, std::shared_ptr<mvAppItem> child);
+    void                                            OnChildrenReordered             (mvAppItem* item); // childslots rearranged in place
 }
 
 struct mvAppItemInfo
@@ -108,6 +110,10 @@ struct mvAppItemInfo
     // dirty flags
     bool dirty_size = true;
     bool dirtyPos   = false;
+
+    // bumped when set_value or configure_item run on the item or on an item
+    // using it as a source, so items sharing its value can tell it changed
+    u32 valueVersion = 0;
 };
 
 struct mvAppItemConfig
@@ -128,8 +134,11 @@ struct mvAppItemConfig
     bool        searchDelayed    = false;
     bool        useInternalLabel = true; // when false, will use specificed label
     bool        tracked          = false;
+    bool        trackState       = false; // capture the full item state every frame
 
     mvPyObjectStrict callback;
+    mvNativeCallback nativeCallback = nullptr; // resolved from a callback capsule
+    void*            nativeUserData = nullptr;
     mvPyObjectStrict user_data;
     mvPyObjectStrict dragCallback;
     mvPyObjectStrict dropCallback;
@@ -293,9 +302,11 @@ GetEntityCommand(mvAppItemType type)
     case mvAppItemType::mvTable:                       return "add_table";
     case mvAppItemType::mvTableColumn:                 return "add_table_column";
     case mvAppItemType::mvTableRow:                    return "add_table_row";
+    case mvAppItemType::mvDataTable:                   return "add_data_table";
     case mvAppItemType::mvDrawLine:                    return "draw_line";
     case mvAppItemType::mvDrawArrow:                   return "draw_arrow";
     case mvAppItemType::mvDrawTriangle:                return "draw_triangle";
+    case mvAppItemType::mvDrawBatch:                   return "draw_batch";
     case mvAppItemType::mvDrawImageQuad:               return "draw_image_quad";
     case mvAppItemType::mvDrawCircle:                  return "draw_circle";
     case mvAppItemType::mvDrawEllipse:                 return "draw_ellipse";
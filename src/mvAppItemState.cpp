@@ -3,6 +3,7 @@
 #include "mvAppItem.h"
 #include "mvContext.h"
 #include "mvPyUtils.h"
+#include "mvItemHandlers.h"
 
 void 
 ResetAppItemState(mvAppItemState& state)
@@ -23,9 +24,21 @@ ResetAppItemState(mvAppItemState& state)
     state.mvRectSizeResized = false;
 }
 
+i32
+GetObservedState(mvAppItemState& state)
+{
+    // the content region is only read once python has queried it
+    // (or with track_state), everything else is always captured
+    if (state.parent && state.parent->config.trackState)
+        return MV_STATE_ALL;
+    return MV_STATE_ALWAYS_CAPTURED | state.observed.load(std::memory_order_relaxed);
+}
+
 void
 UpdateAppItemState(mvAppItemState& state)
 {
+    const i32 observed = GetObservedState(state);
+
     state.lastFrameUpdate = GContext->frame;
     state.hovered = ImGui::IsItemHovered();
     state.active = ImGui::IsItemActive();
@@ -34,12 +47,20 @@ UpdateAppItemState(mvAppItemState& state)
     {
         GContext->focusedItem = state.parent->uuid;
     }
-    state.leftclicked = ImGui::IsItemClicked();
-    state.rightclicked = ImGui::IsItemClicked(1);
-    state.middleclicked = ImGui::IsItemClicked(2);
-    for (int i = 0; i < state.doubleclicked.size(); i++)
+    if (state.hovered) // clicks require the item to be hovered
     {
-        state.doubleclicked[i] = IsItemDoubleClicked(i);
+        state.leftclicked = ImGui::IsItemClicked();
+        state.rightclicked = ImGui::IsItemClicked(1);
+        state.middleclicked = ImGui::IsItemClicked(2);
+        for (int i = 0; i < state.doubleclicked.size(); i++)
+        {
+            state.doubleclicked[i] = IsItemDoubleClicked(i);
+        }
+    }
+    else
+    {
+        state.leftclicked = state.rightclicked = state.middleclicked = false;
+        state.doubleclicked.fill(false);
     }
     state.visible = ImGui::IsItemVisible();
     state.edited = ImGui::IsItemEdited();
@@ -50,7 +71,8 @@ UpdateAppItemState(mvAppItemState& state)
     state.rectMin = { ImGui::GetItemRectMin().x, ImGui::GetItemRectMin().y };
     state.rectMax = { ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y };
     state.rectSize = { ImGui::GetItemRectSize().x, ImGui::GetItemRectSize().y };
-    state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
+    if (observed & MV_STATE_CONT_AVAIL)
+        state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
 
     if (state.mvPrevRectSize.x != state.rectSize.x || state.mvPrevRectSize.y != state.rectSize.y) { state.mvRectSizeResized = true; }
     else state.mvRectSizeResized = false;
@@ -65,6 +87,9 @@ FillAppItemState(PyObject* dict, mvAppItemState& state, i32 applicableState)
 
     bool valid = state.lastFrameUpdate == GContext->frame;
 
+    // captured from the next frame on
+    state.observed.fetch_or(applicableState, std::memory_order_relaxed);
+
     PyDict_SetItemString(dict, "ok", mvPyObject(ToPyBool(state.ok)));
     PyDict_SetItemString(dict, "pos", mvPyObject(ToPyPairII((i32)state.pos.x, (i32)state.pos.y)));
 
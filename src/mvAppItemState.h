@@ -2,6 +2,7 @@
 
 #include "mvCore.h"
 #include <array>
+#include <atomic>
 
 #ifndef PyObject_HEAD
 struct _object;
@@ -32,7 +33,11 @@ enum mvStateItems
     MV_STATE_RECT_SIZE      = 1 << 13,
     MV_STATE_CONT_AVAIL     = 1 << 14,
     MV_STATE_ALL = MV_STATE_HOVER |MV_STATE_ACTIVE |MV_STATE_FOCUSED |MV_STATE_CLICKED |MV_STATE_VISIBLE |MV_STATE_EDITED |MV_STATE_ACTIVATED |MV_STATE_DEACTIVATED |MV_STATE_DEACTIVATEDAE |
-    MV_STATE_TOGGLED_OPEN | MV_STATE_RECT_MIN |MV_STATE_RECT_MAX |MV_STATE_RECT_SIZE |MV_STATE_CONT_AVAIL
+    MV_STATE_TOGGLED_OPEN | MV_STATE_RECT_MIN |MV_STATE_RECT_MAX |MV_STATE_RECT_SIZE |MV_STATE_CONT_AVAIL,
+
+    // captured every frame so one-shot queries (is_item_hovered, ...) are correct;
+    // clicks are only queried while the item is hovered
+    MV_STATE_ALWAYS_CAPTURED = MV_STATE_ALL & ~MV_STATE_CONT_AVAIL
 };
 
 //-----------------------------------------------------------------------------
@@ -42,6 +47,7 @@ enum mvStateItems
 void FillAppItemState  (PyObject* dict, mvAppItemState& state, i32 applicableState); // fills python dict with applicable state values
 void ResetAppItemState (mvAppItemState& state);                                      // reset values to false
 void UpdateAppItemState(mvAppItemState& state);                                      // standard imgui update
+i32  GetObservedState  (mvAppItemState& state);                                      // fields worth capturing this frame (MV_STATE_* mask)
 
 // return actual value if frame is active
 b8 IsItemHovered             (mvAppItemState& state, i32 frameDelay = 0);
@@ -87,5 +93,8 @@ struct mvAppItemState
     mvVec2     contextRegionAvail   = { 0.0f, 0.0f };
     b8         ok                   = true;
     i32        lastFrameUpdate      = 0; // last frame update occured
+    // fields queried from python, unobserved content region reads are skipped;
+    // being atomic it also makes mvAppItemState non-copyable (items own their state in place)
+    std::atomic<i32> observed       = MV_STATE_NONE;
     mvAppItem* parent               = nullptr; // hacky, but quick fix for widget handlers
 };
@@ -6,12 +6,18 @@
 #include "mvItemHandlers.h"
 #include <misc/cpp/imgui_stdlib.h>
 #include "mvTextureItems.h"
+#include <algorithm>
 
 //#include <imgui.h>
 //#define IMGUI_DEFINE_MATH_OPERATORS
 //#include <imgui_internal.h>
 
 static bool KnobFloat(const char* label, float* p_value, float v_min, float v_max, float v_step = 50.f);
+static void UpdateItemFilter(mvItemFilter& filter, const std::vector<std::string>& items);
+static void FillItemFilterDict(const mvItemFilter& filter, PyObject* outDict);
+static void SetItemFilterConfig(PyObject* inDict, mvItemFilter& filter);
+static void DrawItemFilterInput(mvItemFilter& filter, float width);
+static void UpdateFilterSetCache(mvAppItem& item, mvFilterSetConfig& config);
 
 //-----------------------------------------------------------------------------
 // [SECTION] get_item_configuration(...) specifics
@@ -70,6 +76,7 @@ DearPyGui::fill_configuration_dict(const mvComboConfig& inConfig, PyObject* outD
 	mvPyObject py_items = ToPyList(inConfig.items);
 	PyDict_SetItemString(outDict, "height_mode", py_height_mode);
 	PyDict_SetItemString(outDict, "items", py_items);
+	FillItemFilterDict(inConfig.filter, outDict);
 }
 
 void
@@ -341,6 +348,7 @@ DearPyGui::fill_configuration_dict(const mvListboxConfig& inConfig, PyObject* ou
         return;
     PyDict_SetItemString(outDict, "items", mvPyObject(ToPyList(inConfig.names)));
     PyDict_SetItemString(outDict, "num_items", mvPyObject(ToPyInt(inConfig.itemsHeight)));
+    FillItemFilterDict(inConfig.filter, outDict);
 }
 
 void
@@ -670,6 +678,15 @@ DearPyGui::fill_configuration_dict(const mvTooltipConfig& inConfig, PyObject* ou
 	PyDict_SetItemString(outDict, "hide_on_activity", mvPyObject(ToPyBool(inConfig.hide_on_move)));
 }
 
+void
+DearPyGui::fill_configuration_dict(const mvFilterSetConfig& inConfig, PyObject* outDict)
+{
+	if (outDict == nullptr)
+		return;
+
+	PyDict_SetItemString(outDict, "indexed", mvPyObject(ToPyBool(inConfig.indexed)));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] configure_item(...) specifics
 //-----------------------------------------------------------------------------
@@ -704,7 +721,13 @@ DearPyGui::set_configuration(PyObject* inDict, mvComboConfig& outConfig)
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "items")) outConfig.items = ToStringVect(item);
+	if (PyObject* item = PyDict_GetItemString(inDict, "items"))
+	{
+		outConfig.items = ToStringVectOrBuffer(item);
+		outConfig.filter.dirty = true;
+	}
+
+	SetItemFilterConfig(inDict, outConfig.filter);
 
 	if (PyObject* item = PyDict_GetItemString(inDict, "height_mode"))
 	{
@@ -1182,12 +1205,11 @@ DearPyGui::set_configuration(PyObject* inDict, mvListboxConfig& outConfig, mvApp
         return;
 
     if (PyObject* item = PyDict_GetItemString(inDict, "num_items")) outConfig.itemsHeight = ToInt(item);
+    SetItemFilterConfig(inDict, outConfig.filter);
     if (PyObject* item = PyDict_GetItemString(inDict, "items"))
     {
-        outConfig.names = ToStringVect(item);
-        outConfig.charNames.clear();
-        for (const std::string& name : outConfig.names)
-            outConfig.charNames.emplace_back(name.c_str());
+        outConfig.names = ToStringVectOrBuffer(item);
+        outConfig.filter.dirty = true;
 
         outConfig.index = 0;
         outConfig.disabledindex = 0;
@@ -1761,6 +1783,20 @@ DearPyGui::set_configuration(PyObject* inDict, mvTooltipConfig& outConfig)
 	if (PyObject* item = PyDict_GetItemString(inDict, "hide_on_activity")) outConfig.hide_on_move = ToBool(item);
 }
 
+void
+DearPyGui::set_configuration(PyObject* inDict, mvFilterSetConfig& outConfig)
+{
+	if (inDict == nullptr)
+		return;
+
+	if (PyObject* item = PyDict_GetItemString(inDict, "indexed"))
+	{
+		outConfig.indexed = ToBool(item);
+		outConfig.trigrams.clear();
+		outConfig.indexDirty = true;
+	}
+}
+
 void
 DearPyGui::set_configuration(PyObject* inDict, mvKnobFloatConfig& outConfig)
 {
@@ -1829,7 +1865,8 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvComboConfig& outConf
 		switch (i)
 		{
 		case 0:
-			outConfig.items = ToStringVect(item);
+			outConfig.items = ToStringVectOrBuffer(item);
+			outConfig.filter.dirty = true;
 			break;
 
 		default:
@@ -1848,10 +1885,8 @@ DearPyGui::set_positional_configuration(PyObject* inDict, mvListboxConfig& outCo
         switch (i)
         {
             case 0:
-                outConfig.names = ToStringVect(PyTuple_GetItem(inDict, 0));
-                outConfig.charNames.clear();
-                for (const std::string& item : outConfig.names)
-                    outConfig.charNames.emplace_back(item.c_str());
+                outConfig.names = ToStringVectOrBuffer(PyTuple_GetItem(inDict, 0));
+                outConfig.filter.dirty = true;
                 break;
             default:
                 break;
@@ -1968,7 +2003,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvCheckboxConfig&
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -1990,7 +2025,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvDragFloatConfig
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<float>*>(scrItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<float>>*>(scrItem->getValue());
 }
 
 void
@@ -2012,7 +2047,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvDragDoubleConfi
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<double>*>(scrItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<double>>*>(scrItem->getValue());
 }
 
 void
@@ -2034,7 +2069,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvDragIntConfig&
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<int>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<int>>*>(srcItem->getValue());
 }
 
 void
@@ -2122,7 +2157,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvSliderFloatConf
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<float>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<float>>*>(srcItem->getValue());
 }
 
 void
@@ -2166,7 +2201,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvSliderDoubleCon
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<double>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<double>>*>(srcItem->getValue());
 }
 
 void
@@ -2210,7 +2245,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvSliderIntConfig
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<int>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<int>>*>(srcItem->getValue());
 }
 
 void
@@ -2320,7 +2355,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvInputIntConfig&
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<int>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<int>>*>(srcItem->getValue());
 }
 
 void
@@ -2342,7 +2377,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvInputFloatConfi
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<float>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<float>>*>(srcItem->getValue());
 }
 
 void
@@ -2364,7 +2399,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvInputDoubleConf
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<double>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<double>>*>(srcItem->getValue());
 }
 
 void
@@ -2496,7 +2531,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvSelectableConfi
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -2518,7 +2553,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvMenuItemConfig&
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -2540,7 +2575,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvProgressBarConf
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<float>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<float>>*>(srcItem->getValue());
 }
 
 //-----------------------------------------------------------------------------
@@ -2614,20 +2649,30 @@ DearPyGui::draw_simple_plot(ImDrawList* drawlist, mvAppItem& item, const mvSimpl
 	// update state
 	//   * only update if applicable
 	//-----------------------------------------------------------------------------
+	const i32 observed = GetObservedState(item.state);
 	item.state.lastFrameUpdate = GContext->frame;
 	item.state.hovered = ImGui::IsItemHovered();
-	item.state.leftclicked = ImGui::IsItemClicked();
-	item.state.rightclicked = ImGui::IsItemClicked(1);
-	item.state.middleclicked = ImGui::IsItemClicked(2);
-    for (int i = 0; i < item.state.doubleclicked.size(); i++)
-    {
-        item.state.doubleclicked[i] = IsItemDoubleClicked(i);
-    }
+	if (item.state.hovered) // clicks require the item to be hovered
+	{
+		item.state.leftclicked = ImGui::IsItemClicked();
+		item.state.rightclicked = ImGui::IsItemClicked(1);
+		item.state.middleclicked = ImGui::IsItemClicked(2);
+		for (int i = 0; i < item.state.doubleclicked.size(); i++)
+		{
+			item.state.doubleclicked[i] = IsItemDoubleClicked(i);
+		}
+	}
+	else
+	{
+		item.state.leftclicked = item.state.rightclicked = item.state.middleclicked = false;
+		item.state.doubleclicked.fill(false);
+	}
 	item.state.visible = ImGui::IsItemVisible();
 	item.state.rectMin = { ImGui::GetItemRectMin().x, ImGui::GetItemRectMin().y };
 	item.state.rectMax = { ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y };
 	item.state.rectSize = { ImGui::GetItemRectSize().x, ImGui::GetItemRectSize().y };
-	item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
+	if (observed & MV_STATE_CONT_AVAIL)
+		item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
 
 	//-----------------------------------------------------------------------------
 	// post draw
@@ -2806,33 +2851,65 @@ DearPyGui::draw_combo(ImDrawList* drawlist, mvAppItem& item, mvComboConfig& conf
 	{
 		ScopedID id(item.uuid);
 
-		static std::vector<std::string> disabled_items{};
-
 		// The second parameter is the label previewed before opening the combo.
 		bool activated = ImGui::BeginCombo(item.info.internalLabel.c_str(), config.value->c_str(), config.flags);
 		UpdateAppItemState(item.state);
 
 		if (activated)
 		{
+			if (config.filter.show)
+			{
+				if (ImGui::IsWindowAppearing())
+					ImGui::SetKeyboardFocusHere();
+				DrawItemFilterInput(config.filter, -FLT_MIN);
+			}
+
+			UpdateItemFilter(config.filter, config.items);
+			const std::vector<int>& matches = config.filter.matches;
+			int count = item.config.enabled ? (int)matches.size() : 0;
 
-			for (const auto& name : item.config.enabled ? config.items : disabled_items)
+			// only visible rows are submitted, so scroll the selected row
+			// into view ourselves when the popup opens. Rows start below
+			// the filter input, if shown.
+			if (ImGui::IsWindowAppearing())
 			{
-				bool is_selected = (*config.value == name);
-				if (ImGui::Selectable((name).c_str(), is_selected))
+				float top = ImGui::GetCursorPosY() - ImGui::GetStyle().WindowPadding.y;
+				for (int row = 0; row < count; row++)
 				{
-					if (item.config.enabled) { *config.value = name; }
-
-					auto value = *config.value;
-					mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyString(value))});
+					if (config.items[matches[row]] == *config.value)
+					{
+						ImGui::SetScrollY(top + row * ImGui::GetTextLineHeightWithSpacing());
+						break;
+					}
 				}
+			}
 
-				item.state.edited = ImGui::IsItemEdited();
-				item.state.deactivated = ImGui::IsItemDeactivated();
-				item.state.deactivatedAfterEdit = ImGui::IsItemDeactivatedAfterEdit();
+			ImGuiListClipper clipper;
+			clipper.Begin(count);
+			while (clipper.Step())
+			{
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+				{
+					const std::string& name = config.items[matches[row]];
+					ImGui::PushID(matches[row]);
+					bool is_selected = (*config.value == name);
+					if (ImGui::Selectable(name.c_str(), is_selected))
+					{
+						if (item.config.enabled) { *config.value = name; }
 
-				// Set the initial focus when opening the combo (scrolling + for keyboard navigation support in the upcoming navigation branch)
-				if (is_selected)
-					ImGui::SetItemDefaultFocus();
+						auto value = *config.value;
+						mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyString(value))});
+					}
+
+					item.state.edited = ImGui::IsItemEdited();
+					item.state.deactivated = ImGui::IsItemDeactivated();
+					item.state.deactivatedAfterEdit = ImGui::IsItemDeactivatedAfterEdit();
+
+					// Set the initial focus when opening the combo (scrolling + for keyboard navigation support in the upcoming navigation branch)
+					if (is_selected)
+						ImGui::SetItemDefaultFocus();
+					ImGui::PopID();
+				}
 			}
 
 			ImGui::EndCombo();
@@ -2916,10 +2993,12 @@ DearPyGui::draw_checkbox(ImDrawList* drawlist, mvAppItem& item, mvCheckboxConfig
 		// push imgui id to prevent name collisions
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		bool value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
-		if (ImGui::Checkbox(item.info.internalLabel.c_str(), item.config.enabled ? config.value.get() : &config.disabled_value))
+		if (ImGui::Checkbox(item.info.internalLabel.c_str(), item.config.enabled ? &value : &config.disabled_value))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyBool(*config.value))});
 		}
 	}
@@ -3006,12 +3085,14 @@ DearPyGui::draw_drag_float(ImDrawList* drawlist, mvAppItem& item, mvDragFloatCon
 	//-----------------------------------------------------------------------------
 	{
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		float value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (ImGui::DragFloat(item.info.internalLabel.c_str(),
-			item.config.enabled ? config.value.get() : &config.disabled_value,
+			item.config.enabled ? &value : &config.disabled_value,
 			config.speed, config.minv, config.maxv, config.format.c_str(), config.flags))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyFloat(*config.value))});
 		}
 	}
@@ -3099,12 +3180,14 @@ DearPyGui::draw_drag_double(ImDrawList* drawlist, mvAppItem& item, mvDragDoubleC
 	//-----------------------------------------------------------------------------
 	{
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		double value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (ImGui::DragScalar(item.info.internalLabel.c_str(), ImGuiDataType_Double,
-			item.config.enabled ? config.value.get() : &config.disabled_value,
+			item.config.enabled ? &value : &config.disabled_value,
 			config.speed, &config.minv, &config.maxv, config.format.c_str(), config.flags))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyDouble(*config.value))});
 		}
 	}
@@ -3192,12 +3275,14 @@ DearPyGui::draw_drag_int(ImDrawList* drawlist, mvAppItem& item, mvDragIntConfig&
 
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		int value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (ImGui::DragInt(item.info.internalLabel.c_str(),
-			item.config.enabled ? config.value.get() : &config.disabled_value, config.speed,
+			item.config.enabled ? &value : &config.disabled_value, config.speed,
 			config.minv, config.maxv, config.format.c_str(), config.flags))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyInt(*config.value))});
 		}
 	}
@@ -3596,7 +3681,8 @@ DearPyGui::draw_slider_float(ImDrawList* drawlist, mvAppItem& item, mvSliderFloa
 	{
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		float value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (config.vertical)
 		{
@@ -3605,16 +3691,18 @@ DearPyGui::draw_slider_float(ImDrawList* drawlist, mvAppItem& item, mvSliderFloa
 			if ((float)item.config.width < 1.0f)
 				item.config.width = 20;
 
-			if (ImGui::VSliderFloat(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), item.config.enabled ? config.value.get() : &config.disabled_value, config.minv, config.maxv, config.format.c_str()))
+			if (ImGui::VSliderFloat(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), item.config.enabled ? &value : &config.disabled_value, config.minv, config.maxv, config.format.c_str()))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyFloat(*config.value))});
 			}
 
 		}
 		else
 		{
-			if (ImGui::SliderFloat(item.info.internalLabel.c_str(), item.config.enabled ? config.value.get() : &config.disabled_value, config.minv, config.maxv, config.format.c_str(), config.flags))
+			if (ImGui::SliderFloat(item.info.internalLabel.c_str(), item.config.enabled ? &value : &config.disabled_value, config.minv, config.maxv, config.format.c_str(), config.flags))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyFloat(*config.value))});
 			}
 
@@ -3703,7 +3791,8 @@ DearPyGui::draw_slider_double(ImDrawList* drawlist, mvAppItem& item, mvSliderDou
 	{
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		double value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (config.vertical)
 		{
@@ -3712,16 +3801,18 @@ DearPyGui::draw_slider_double(ImDrawList* drawlist, mvAppItem& item, mvSliderDou
 			if ((float)item.config.width < 1.0f)
 				item.config.width = 20;
 
-			if (ImGui::VSliderScalar(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), ImGuiDataType_Double, item.config.enabled ? config.value.get() : &config.disabled_value, &config.minv, &config.maxv, config.format.c_str()))
+			if (ImGui::VSliderScalar(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), ImGuiDataType_Double, item.config.enabled ? &value : &config.disabled_value, &config.minv, &config.maxv, config.format.c_str()))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyDouble(*config.value))});
 			}
 
 		}
 		else
 		{
-			if (ImGui::SliderScalar(item.info.internalLabel.c_str(), ImGuiDataType_Double, item.config.enabled ? config.value.get() : &config.disabled_value, &config.minv, &config.maxv, config.format.c_str(), config.flags))
+			if (ImGui::SliderScalar(item.info.internalLabel.c_str(), ImGuiDataType_Double, item.config.enabled ? &value : &config.disabled_value, &config.minv, &config.maxv, config.format.c_str(), config.flags))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyDouble(*config.value))});
 			}
 
@@ -4014,7 +4105,8 @@ DearPyGui::draw_slider_int(ImDrawList* drawlist, mvAppItem& item, mvSliderIntCon
 	{
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		int value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
 		if (config.vertical)
 		{
@@ -4023,16 +4115,18 @@ DearPyGui::draw_slider_int(ImDrawList* drawlist, mvAppItem& item, mvSliderIntCon
 			if ((float)item.config.width < 1.0f)
 				item.config.width = 20;
 
-			if (ImGui::VSliderInt(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), item.config.enabled ? config.value.get() : &config.disabled_value, config.minv, config.maxv, config.format.c_str()))
+			if (ImGui::VSliderInt(item.info.internalLabel.c_str(), ImVec2((float)item.config.width, (float)item.config.height), item.config.enabled ? &value : &config.disabled_value, config.minv, config.maxv, config.format.c_str()))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyInt(*config.value))});
 			}
 
 		}
 		else
 		{
-			if (ImGui::SliderInt(item.info.internalLabel.c_str(), item.config.enabled ? config.value.get() : &config.disabled_value, config.minv, config.maxv, config.format.c_str(), config.flags))
+			if (ImGui::SliderInt(item.info.internalLabel.c_str(), item.config.enabled ? &value : &config.disabled_value, config.minv, config.maxv, config.format.c_str(), config.flags))
 			{
+				*config.value = value;
 				mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyInt(*config.value))});
 			}
 
@@ -4240,11 +4334,41 @@ DearPyGui::draw_listbox(ImDrawList *drawlist, mvAppItem &item, mvListboxConfig &
         ImGuiStyle* style = &ImGui::GetStyle();
         ImGui::PushStyleColor(ImGuiCol_Header, style->Colors[ImGuiCol_FrameBgActive]);
 
-        if (ImGui::ListBox(item.info.internalLabel.c_str(), item.config.enabled ? &config.index : &config.disabledindex, config.charNames.data(), (int)config.names.size(), config.itemsHeight))
+        float width = ImGui::CalcItemWidth();
+        if (config.filter.show)
+            DrawItemFilterInput(config.filter, width);
+
+        UpdateItemFilter(config.filter, config.names);
+        const std::vector<int>& matches = config.filter.matches;
+        int* index = item.config.enabled ? &config.index : &config.disabledindex;
+
+        // same sizing as ImGui::ListBox, but rows are clipped so only the
+        // visible part of large item lists is submitted
+        float height = floorf(ImGui::GetTextLineHeightWithSpacing() * (config.itemsHeight + 0.25f) + style->FramePadding.y * 2.0f);
+        if (ImGui::BeginListBox(item.info.internalLabel.c_str(), ImVec2(width, height)))
         {
-            *config.value = config.names[config.index];
-            config.disabled_value = config.names[config.index];
-			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyString(*config.value))});
+            ImGuiListClipper clipper;
+            clipper.Begin((int)matches.size());
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    int i = matches[row];
+                    ImGui::PushID(i);
+                    bool is_selected = (i == *index);
+                    if (ImGui::Selectable(config.names[i].c_str(), is_selected))
+                    {
+                        *index = i;
+                        *config.value = config.names[config.index];
+                        config.disabled_value = config.names[config.index];
+                        mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyString(*config.value))});
+                    }
+                    if (is_selected)
+                        ImGui::SetItemDefaultFocus();
+                    ImGui::PopID();
+                }
+            }
+            ImGui::EndListBox();
         }
 
         ImGui::PopStyleColor();
@@ -4363,17 +4487,26 @@ DearPyGui::draw_radio_button(ImDrawList* drawlist, mvAppItem& item, mvRadioButto
 	//-----------------------------------------------------------------------------
 	// update state
 	//-----------------------------------------------------------------------------
+	const i32 observed = GetObservedState(item.state);
 	item.state.lastFrameUpdate = GContext->frame;
 	item.state.hovered = ImGui::IsItemHovered();
 	item.state.active = ImGui::IsItemActive();
 	item.state.focused = ImGui::IsItemFocused();
-	item.state.leftclicked = ImGui::IsItemClicked();
-	item.state.rightclicked = ImGui::IsItemClicked(1);
-	item.state.middleclicked = ImGui::IsItemClicked(2);
-    for (int i = 0; i < item.state.doubleclicked.size(); i++)
-    {
-        item.state.doubleclicked[i] = IsItemDoubleClicked(i);
-    }
+	if (item.state.hovered) // clicks require the item to be hovered
+	{
+		item.state.leftclicked = ImGui::IsItemClicked();
+		item.state.rightclicked = ImGui::IsItemClicked(1);
+		item.state.middleclicked = ImGui::IsItemClicked(2);
+		for (int i = 0; i < item.state.doubleclicked.size(); i++)
+		{
+			item.state.doubleclicked[i] = IsItemDoubleClicked(i);
+		}
+	}
+	else
+	{
+		item.state.leftclicked = item.state.rightclicked = item.state.middleclicked = false;
+		item.state.doubleclicked.fill(false);
+	}
 	item.state.visible = ImGui::IsItemVisible();
 	item.state.activated = ImGui::IsItemActivated();
 	item.state.deactivated = ImGui::IsItemDeactivated();
@@ -4382,7 +4515,8 @@ DearPyGui::draw_radio_button(ImDrawList* drawlist, mvAppItem& item, mvRadioButto
 	item.state.rectMin = { ImGui::GetItemRectMin().x, ImGui::GetItemRectMin().y };
 	item.state.rectMax = { ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y };
 	item.state.rectSize = { ImGui::GetItemRectSize().x, ImGui::GetItemRectSize().y };
-	item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
+	if (observed & MV_STATE_CONT_AVAIL)
+		item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
 
 	//-----------------------------------------------------------------------------
 	// post draw
@@ -4567,23 +4701,26 @@ DearPyGui::draw_input_int(ImDrawList* drawlist, mvAppItem& item, mvInputIntConfi
 
 		ScopedID id(item.uuid);
 
-		if (ImGui::InputInt(item.info.internalLabel.c_str(), config.value.get(), config.step, config.step_fast, config.flags))
+		int value = *config.value;
+		if (ImGui::InputInt(item.info.internalLabel.c_str(), &value, config.step, config.step_fast, config.flags))
 		{
 			// determines clamped cases
 			if (config.min_clamped && config.max_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
-				else if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value < config.minv) value = config.minv;
+				else if (value > config.maxv) value = config.maxv;
 			}
 			else if (config.min_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
+				if (value < config.minv) value = config.minv;
 			}
 			else if (config.max_clamped)
 			{
-				if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value > config.maxv) value = config.maxv;
 			}
 
+			*config.value = value;
+
 			// If the widget is edited through ctrl+click mode the active value will be entered every frame.
 			// If the value is out of bounds the value will be overwritten with max or min so each frame the value will be switching between the
 			// ctrl+click value and the bounds value until the widget is not in ctrl+click mode. To prevent the callback from running every
@@ -4822,23 +4959,26 @@ DearPyGui::draw_input_float(ImDrawList* drawlist, mvAppItem& item, mvInputFloatC
 
 		ScopedID id(item.uuid);
 
-		if (ImGui::InputFloat(item.info.internalLabel.c_str(), config.value.get(), config.step, config.step_fast, config.format.c_str(), config.flags))
+		float value = *config.value;
+		if (ImGui::InputFloat(item.info.internalLabel.c_str(), &value, config.step, config.step_fast, config.format.c_str(), config.flags))
 		{
 			// determines clamped cases
 			if (config.min_clamped && config.max_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
-				else if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value < config.minv) value = config.minv;
+				else if (value > config.maxv) value = config.maxv;
 			}
 			else if (config.min_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
+				if (value < config.minv) value = config.minv;
 			}
 			else if (config.max_clamped)
 			{
-				if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value > config.maxv) value = config.maxv;
 			}
 
+			*config.value = value;
+
 			// If the widget is edited through ctrl+click mode the active value will be entered every frame.
 			// If the value is out of bounds the value will be overwritten with max or min so each frame the value will be switching between the
 			// ctrl+click value and the bounds value until the widget is not in ctrl+click mode. To prevent the callback from running every
@@ -4934,10 +5074,12 @@ DearPyGui::draw_knob_float(ImDrawList* drawlist, mvAppItem& item, mvKnobFloatCon
 
 		ScopedID id(item.uuid);
 
-		if (!item.config.enabled) config.disabled_value = *config.value;
+		float value = *config.value;
+		if (!item.config.enabled) config.disabled_value = value;
 
-		if (KnobFloat(item.config.specifiedLabel.c_str(), item.config.enabled ? config.value.get() : &config.disabled_value, config.minv, config.maxv, config.step))
+		if (KnobFloat(item.config.specifiedLabel.c_str(), item.config.enabled ? &value : &config.disabled_value, config.minv, config.maxv, config.step))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyFloat(*config.value))});
 		}
 	}
@@ -5025,23 +5167,26 @@ DearPyGui::draw_input_double(ImDrawList* drawlist, mvAppItem& item, mvInputDoubl
 
 		ScopedID id(item.uuid);
 
-		if (ImGui::InputScalar(item.info.internalLabel.c_str(), ImGuiDataType_Double, (void*)config.value.get(), (void*)(config.step > 0 ? &config.step : NULL), (void*)(config.step_fast > 0 ? &config.step_fast : NULL), config.format.c_str(), config.flags))
+		double value = *config.value;
+		if (ImGui::InputScalar(item.info.internalLabel.c_str(), ImGuiDataType_Double, (void*)&value, (void*)(config.step > 0 ? &config.step : NULL), (void*)(config.step_fast > 0 ? &config.step_fast : NULL), config.format.c_str(), config.flags))
 		{
 			// determines clamped cases
 			if (config.min_clamped && config.max_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
-				else if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value < config.minv) value = config.minv;
+				else if (value > config.maxv) value = config.maxv;
 			}
 			else if (config.min_clamped)
 			{
-				if (*config.value < config.minv) *config.value = config.minv;
+				if (value < config.minv) value = config.minv;
 			}
 			else if (config.max_clamped)
 			{
-				if (*config.value > config.maxv) *config.value = config.maxv;
+				if (value > config.maxv) value = config.maxv;
 			}
 
+			*config.value = value;
+
 			// If the widget is edited through ctrl+click mode the active value will be entered every frame.
 			// If the value is out of bounds the value will be overwritten with max or min so each frame the value will be switching between the
 			// ctrl+click value and the bounds value until the widget is not in ctrl+click mode. To prevent the callback from running every
@@ -5437,15 +5582,20 @@ DearPyGui::draw_text(ImDrawList* drawlist, mvAppItem& item, mvTextConfig& config
 			// update state - locally updating the item state when label is used. We do not
 			// need to update RectMin parameter since its based on the text corner.
 			//-----------------------------------------------------------------------------
-			item.state.hovered |= ImGui::IsItemHovered();
+			const i32 observed = GetObservedState(item.state);
+			const bool labelHovered = ImGui::IsItemHovered();
+			item.state.hovered |= labelHovered;
 			item.state.active |= ImGui::IsItemActive();
 			item.state.focused |= ImGui::IsItemFocused();
-			item.state.leftclicked |= ImGui::IsItemClicked();
-			item.state.rightclicked |= ImGui::IsItemClicked(1);
-			item.state.middleclicked |= ImGui::IsItemClicked(2);
-			for (int i = 0; i < item.state.doubleclicked.size(); i++)
+			if (labelHovered) // clicks require the label to be hovered
 			{
-				item.state.doubleclicked[i] = IsItemDoubleClicked(i);
+				item.state.leftclicked |= ImGui::IsItemClicked();
+				item.state.rightclicked |= ImGui::IsItemClicked(1);
+				item.state.middleclicked |= ImGui::IsItemClicked(2);
+				for (int i = 0; i < item.state.doubleclicked.size(); i++)
+				{
+					item.state.doubleclicked[i] = IsItemDoubleClicked(i);
+				}
 			}
 			item.state.visible |= ImGui::IsItemVisible();
 			item.state.edited |= ImGui::IsItemEdited();
@@ -5455,7 +5605,8 @@ DearPyGui::draw_text(ImDrawList* drawlist, mvAppItem& item, mvTextConfig& config
 			item.state.toggledOpen = ImGui::IsItemToggledOpen();
 			item.state.rectMax = { ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y};
 			item.state.rectSize = { item.state.rectMax.x - item.state.rectMin.x, item.state.rectMax.y - item.state.rectMin.y };
-			item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x + item.state.contextRegionAvail.x, ImGui::GetContentRegionAvail().y + item.state.contextRegionAvail.y };
+			if (observed & MV_STATE_CONT_AVAIL)
+				item.state.contextRegionAvail = { ImGui::GetContentRegionAvail().x + item.state.contextRegionAvail.x, ImGui::GetContentRegionAvail().y + item.state.contextRegionAvail.y };
 
 			if (item.state.mvPrevRectSize.x != item.state.rectSize.x || item.state.mvPrevRectSize.y != item.state.rectSize.y) { item.state.mvRectSizeResized = true; }
 			else item.state.mvRectSizeResized = false;
@@ -5539,8 +5690,10 @@ DearPyGui::draw_selectable(ImDrawList* drawlist, mvAppItem& item, mvSelectableCo
 	{
 		ScopedID id(item.uuid);
 
-		if (ImGui::Selectable(item.info.internalLabel.c_str(), config.value.get(), config.flags, ImVec2((float)item.config.width, (float)item.config.height)))
+		bool value = *config.value;
+		if (ImGui::Selectable(item.info.internalLabel.c_str(), &value, config.flags, ImVec2((float)item.config.width, (float)item.config.height)))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyBool(*config.value))});
 		}
 	}
@@ -5721,9 +5874,12 @@ DearPyGui::draw_menu_item(ImDrawList* drawlist, mvAppItem& item, mvMenuItemConfi
 		// constants.
 		ImGui::PushStyleColor(ImGuiCol_TextDisabled, ImGui::GetStyleColorVec4(ImGuiCol_Text));
 
+		bool value = *config.value;
+
 		// create menu item and see if its selected
-		if (ImGui::MenuItem(item.info.internalLabel.c_str(), config.shortcut.c_str(), config.check ? config.value.get() : nullptr, item.config.enabled))
+		if (ImGui::MenuItem(item.info.internalLabel.c_str(), config.shortcut.c_str(), config.check ? &value : nullptr, item.config.enabled))
 		{
+			*config.value = value;
 			mvAddCallbackJob({&item.config.callback, item, MV_APP_DATA_FUNC(ToPyBool(*config.value))});
 		}
 
@@ -6085,29 +6241,11 @@ DearPyGui::draw_filter_set(ImDrawList* drawlist, mvAppItem& item, mvFilterSetCon
 	if (item.config.width != 0)
 		ImGui::PushItemWidth((float)item.config.width);
 
-	if (config.imguiFilter.IsActive())
-	{
-		for (auto& childset : item.childslots)
-		{
-			for (auto& child : childset)
-			{
-				if (!config.imguiFilter.PassFilter(child->config.filter.c_str()))
-					continue;
-
-				child->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
-			}
-		}
-
-	}
-	else
-	{
+	UpdateFilterSetCache(item, config);
 
-		for (auto& childset : item.childslots)
-		{
-			for (auto& child : childset)
-				child->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
-		}
-	}
+	// filtered out children are never visited
+	for (int i : config.passing)
+		config.children[i]->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 
 	if (item.config.width != 0)
 		ImGui::PopItemWidth();
@@ -6503,4 +6641,293 @@ bool KnobFloat(const char* label, float* p_value, float v_min, float v_max, floa
     }
 
     return value_changed;
-}
\ No newline at end of file
+}
+
+static void
+FillItemFilterDict(const mvItemFilter& filter, PyObject* outDict)
+{
+    PyDict_SetItemString(outDict, "filter", mvPyObject(ToPyString(filter.text)));
+    PyDict_SetItemString(outDict, "filter_mode", mvPyObject(ToPyInt(filter.mode)));
+    PyDict_SetItemString(outDict, "show_filter", mvPyObject(ToPyBool(filter.show)));
+}
+
+static void
+SetItemFilterConfig(PyObject* inDict, mvItemFilter& filter)
+{
+    if (PyObject* item = PyDict_GetItemString(inDict, "filter")) filter.text = ToString(item);
+    if (PyObject* item = PyDict_GetItemString(inDict, "filter_mode")) filter.mode = ToInt(item);
+    if (PyObject* item = PyDict_GetItemString(inDict, "show_filter")) filter.show = ToBool(item);
+}
+
+static void
+DrawItemFilterInput(mvItemFilter& filter, float width)
+{
+    ImGui::SetNextItemWidth(width);
+    ImGui::InputTextWithHint("##filter", "Filter", &filter.text);
+}
+
+// length of the UTF-8 sequence starting with the lead byte c
+static size_t
+Utf8SequenceLength(unsigned char c)
+{
+    if (c < 0xC0) return 1; // ascii or stray continuation byte
+    if (c < 0xE0) return 2;
+    if (c < 0xF0) return 3;
+    return 4;
+}
+
+// simple case folding for latin, greek and cyrillic letters, enough for
+// the filter to match "É" with "é"; other scripts are left untouched
+static u32
+LowerCodepoint(u32 c)
+{
+    if (c < 0x80)
+        return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    if ((c >= 0xC0 && c <= 0xDE && c != 0xD7) || (c >= 0x391 && c <= 0x3AB && c != 0x3A2) || (c >= 0x410 && c <= 0x42F))
+        return c + 32;
+    if (c >= 0x400 && c <= 0x40F)
+        return c + 80;
+    if ((c >= 0x100 && c <= 0x137 && c != 0x130) || (c >= 0x14A && c <= 0x177))
+        return c | 1;
+    if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E))
+        return (c & 1) ? c + 1 : c;
+    if (c == 0x178)
+        return 0xFF;
+    return c;
+}
+
+static std::string
+LowerUtf8(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (size_t i = 0; i < value.size();)
+    {
+        unsigned char lead = (unsigned char)value[i];
+        size_t length = Utf8SequenceLength(lead);
+        if (length == 1 || i + length > value.size())
+        {
+            // ascii, or invalid bytes copied as is
+            result.push_back(lead < 0x80 ? (char)LowerCodepoint(lead) : (char)lead);
+            i++;
+            continue;
+        }
+
+        u32 c = lead & (0xFF >> (length + 1));
+        for (size_t j = 1; j < length; j++)
+            c = (c << 6) | ((unsigned char)value[i + j] & 0x3F);
+        c = LowerCodepoint(c);
+
+        // every folded codepoint keeps its encoded length
+        if (length == 2)
+        {
+            result.push_back((char)(0xC0 | (c >> 6)));
+            result.push_back((char)(0x80 | (c & 0x3F)));
+        }
+        else
+            result.append(value, i, length);
+        i += length;
+    }
+    return result;
+}
+
+static bool
+MatchesItemFilter(const std::string& key, const std::string& text, int mode)
+{
+    if (mode == (int)mvItemFilterMode::mvItemFilter_Prefix)
+        return key.compare(0, text.size(), text) == 0;
+
+    if (mode == (int)mvItemFilterMode::mvItemFilter_Fuzzy)
+    {
+        // characters must appear in order, not necessarily adjacent;
+        // multibyte characters are matched as a whole sequence
+        size_t pos = 0;
+        for (size_t i = 0; i < text.size();)
+        {
+            size_t length = std::min(Utf8SequenceLength((unsigned char)text[i]), text.size() - i);
+            pos = key.find(text.c_str() + i, pos, length);
+            if (pos == std::string::npos)
+                return false;
+            pos += length;
+            i += length;
+        }
+        return true;
+    }
+
+    return key.find(text) != std::string::npos;
+}
+
+static void
+UpdateItemFilter(mvItemFilter& filter, const std::vector<std::string>& items)
+{
+    if (!filter.dirty && filter.mode == filter.appliedMode && filter.text == filter.appliedText)
+        return;
+
+    std::string key = LowerUtf8(filter.text);
+
+    // extending the text (in any mode) can only remove matches, so the
+    // previous match list is filtered instead of rescanning every item
+    bool narrow = !filter.dirty && filter.mode == filter.appliedMode
+        && key.size() >= filter.appliedKey.size()
+        && key.compare(0, filter.appliedKey.size(), filter.appliedKey) == 0;
+
+    if (filter.dirty)
+    {
+        filter.keys.resize(items.size());
+        for (size_t i = 0; i < items.size(); i++)
+            filter.keys[i] = LowerUtf8(items[i]);
+    }
+
+    if (narrow)
+    {
+        size_t count = 0;
+        for (int i : filter.matches)
+        {
+            if (MatchesItemFilter(filter.keys[i], key, filter.mode))
+                filter.matches[count++] = i;
+        }
+        filter.matches.resize(count);
+    }
+    else
+    {
+        filter.matches.clear();
+        filter.matches.reserve(items.size());
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            if (key.empty() || MatchesItemFilter(filter.keys[i], key, filter.mode))
+                filter.matches.push_back((int)i);
+        }
+    }
+
+    filter.appliedText = filter.text;
+    filter.appliedKey = key;
+    filter.appliedMode = filter.mode;
+    filter.dirty = false;
+}
+
+static u32
+FilterTrigram(const char* text)
+{
+    auto lower = [](char c) { return (u32)(unsigned char)(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c); };
+    return lower(text[0]) | (lower(text[1]) << 8) | (lower(text[2]) << 16);
+}
+
+static void
+BuildFilterSetIndex(mvFilterSetConfig& config)
+{
+    config.trigrams.clear();
+    for (int i = 0; i < (int)config.children.size(); i++)
+    {
+        if (config.children[i] == nullptr)
+            continue;
+
+        const std::string& key = config.children[i]->config.filter;
+        for (size_t j = 0; j + 3 <= key.size(); j++)
+        {
+            std::vector<int>& postings = config.trigrams[FilterTrigram(&key[j])];
+            if (postings.empty() || postings.back() != i)
+                postings.push_back(i);
+        }
+    }
+    config.indexDirty = false;
+}
+
+// collects the children that may pass the current filter from the
+// trigram index. Returns false if the filter can't be resolved through
+// the index (exclusions or terms shorter than 3 characters).
+static bool
+GetFilterSetCandidates(mvFilterSetConfig& config, std::vector<int>& candidates)
+{
+    for (const auto& range : config.imguiFilter.Filters)
+    {
+        if (range.empty())
+            continue;
+        if (range.b[0] == '-' || range.e - range.b < 3)
+            return false;
+    }
+
+    if (config.indexDirty)
+        BuildFilterSetIndex(config);
+
+    candidates.clear();
+    for (const auto& range : config.imguiFilter.Filters)
+    {
+        if (range.empty())
+            continue;
+
+        // every match contains all trigrams of the term, so the
+        // shortest posting list bounds the candidates
+        const std::vector<int>* shortest = nullptr;
+        for (const char* c = range.b; c + 3 <= range.e; c++)
+        {
+            auto found = config.trigrams.find(FilterTrigram(c));
+            if (found == config.trigrams.end())
+            {
+                shortest = nullptr;
+                break;
+            }
+            if (shortest == nullptr || found->second.size() < shortest->size())
+                shortest = &found->second;
+        }
+
+        if (shortest)
+            candidates.insert(candidates.end(), shortest->begin(), shortest->end());
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    return true;
+}
+
+static void
+UpdateFilterSetCache(mvAppItem& item, mvFilterSetConfig& config)
+{
+    // the hooks on child add/remove/reorder and filter_key changes mark the
+    // set dirty, the snapshot is only rebuilt then
+    if (config.dirty)
+    {
+        config.children.clear();
+        for (auto& childset : item.childslots)
+            for (auto& child : childset)
+                config.children.push_back(child.get());
+    }
+
+    if (!config.dirty && config.appliedFilter == config.imguiFilter.InputBuf)
+        return;
+
+    if (config.dirty)
+        config.indexDirty = true;
+
+    config.passing.clear();
+    if (!config.imguiFilter.IsActive())
+    {
+        for (int i = 0; i < (int)config.children.size(); i++)
+        {
+            if (config.children[i])
+                config.passing.push_back(i);
+        }
+    }
+    else
+    {
+        std::vector<int> candidates;
+        if (config.indexed && GetFilterSetCandidates(config, candidates))
+        {
+            for (int i : candidates)
+            {
+                if (config.imguiFilter.PassFilter(config.children[i]->config.filter.c_str()))
+                    config.passing.push_back(i);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < (int)config.children.size(); i++)
+            {
+                if (config.children[i] && config.imguiFilter.PassFilter(config.children[i]->config.filter.c_str()))
+                    config.passing.push_back(i);
+            }
+        }
+    }
+
+    config.appliedFilter = config.imguiFilter.InputBuf;
+    config.dirty = false;
+}
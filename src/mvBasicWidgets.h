@@ -2,6 +2,7 @@
 
 #include "mvItemRegistry.h"
 #include <array>
+#include <unordered_map>
 
 struct mvSimplePlotConfig;
 struct mvButtonConfig;
@@ -75,6 +76,7 @@ namespace DearPyGui
     void fill_configuration_dict(const mvImageButtonConfig& inConfig, PyObject* outDict);
     void fill_configuration_dict(const mvKnobFloatConfig& inConfig, PyObject* outDict);
     void fill_configuration_dict(const mvTooltipConfig& inConfig, PyObject* outDict);
+    void fill_configuration_dict(const mvFilterSetConfig& inConfig, PyObject* outDict);
 
     // specific part of `configure_item(...)`
     void set_configuration(PyObject* inDict, mvSimplePlotConfig& outConfig);
@@ -110,6 +112,7 @@ namespace DearPyGui
     void set_configuration(PyObject* inDict, mvImageButtonConfig& outConfig);
     void set_configuration(PyObject* inDict, mvTooltipConfig& outConfig);
     void set_configuration(PyObject* inDict, mvKnobFloatConfig& outConfig);
+    void set_configuration(PyObject* inDict, mvFilterSetConfig& outConfig);
 
     // positional args TODO: combine with above
     void set_required_configuration(PyObject* inDict, mvImageConfig& outConfig);
@@ -204,6 +207,31 @@ enum class mvComboHeightMode
     mvComboHeight_Largest
 };
 
+enum class mvItemFilterMode
+{
+    mvItemFilter_Substring = 0L,
+    mvItemFilter_Prefix,
+    mvItemFilter_Fuzzy
+};
+
+// case-insensitive filter shared by combo & listbox. lowercase keys are
+// built once per items change and the match list is narrowed in place
+// when the filter text is only extended.
+struct mvItemFilter
+{
+    std::string              text;
+    int                      mode = (int)mvItemFilterMode::mvItemFilter_Substring;
+    bool                     show = false;
+
+    // cached state
+    std::vector<std::string> keys;
+    std::vector<int>         matches;
+    std::string              appliedText; // raw text used for last update
+    std::string              appliedKey;  // lowercase text used for last update
+    int                      appliedMode = -1;
+    bool                     dirty = true; // items changed
+};
+
 struct mvSimplePlotConfig
 {
     std::shared_ptr<std::vector<float>> value = std::make_shared<std::vector<float>>(std::vector<float>{0.0f});
@@ -227,13 +255,14 @@ struct mvComboConfig
     std::vector<std::string> items;
     bool                     popup_align_left = false;
     bool                     no_preview = false;
+    mvItemFilter             filter;
     std::shared_ptr<std::string>       value = std::make_shared<std::string>("");
     std::string              disabled_value;
 };
 
 struct mvCheckboxConfig
 {
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool        disabled_value = false;
 };
 
@@ -245,7 +274,7 @@ struct mvDragFloatConfig
     std::string         format = "%.3f";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -257,7 +286,7 @@ struct mvDragDoubleConfig
     std::string         format = "%.3f";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<double>       value = std::make_shared<double>(0.0);
+    std::shared_ptr<std::atomic<double>> value = std::make_shared<std::atomic<double>>(0.0);
     double              disabled_value = 0.0;
 };
 
@@ -269,7 +298,7 @@ struct mvDragIntConfig
     std::string         format = "%d";
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<std::atomic<int>> value = std::make_shared<std::atomic<int>>(0);
     int                 disabled_value = 0;
 };
 
@@ -320,7 +349,7 @@ struct mvSliderIntConfig
     bool                vertical = false;
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<std::atomic<int>> value = std::make_shared<std::atomic<int>>(0);
     int                 disabled_value = 0;
 };
 
@@ -332,7 +361,7 @@ struct mvSliderFloatConfig
     bool                vertical = false;
     ImGuiInputTextFlags flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -344,7 +373,7 @@ struct mvSliderDoubleConfig
     bool                 vertical = false;
     ImGuiInputTextFlags  flags = ImGuiSliderFlags_None;
     ImGuiInputTextFlags  stor_flags = ImGuiSliderFlags_None;
-    std::shared_ptr<double>        value = std::make_shared<double>(0.0);
+    std::shared_ptr<std::atomic<double>> value = std::make_shared<std::atomic<double>>(0.0);
     double               disabled_value = 0.0;
 };
 
@@ -388,7 +417,7 @@ struct mvListboxConfig
 {
     std::vector<std::string> names;
     int                      itemsHeight = 3; // number of items to show (default -1)
-    std::vector<const char*> charNames;
+    mvItemFilter             filter;
     int                      index = 0;
     int                      disabledindex = 0;
     std::shared_ptr<std::string>       value = std::make_shared<std::string>("");
@@ -426,7 +455,7 @@ struct mvInputIntConfig
     ImGuiInputTextFlags flags = 0;
     ImGuiInputTextFlags stor_flags = 0;
     int                 last_value = 0;
-    std::shared_ptr<int>          value = std::make_shared<int>(0);
+    std::shared_ptr<std::atomic<int>> value = std::make_shared<std::atomic<int>>(0);
     int                 disabled_value = 0;
 };
 
@@ -442,7 +471,7 @@ struct mvInputFloatConfig
     ImGuiInputTextFlags flags = 0;
     ImGuiInputTextFlags stor_flags = 0;
     float               last_value = 0.0f;
-    std::shared_ptr<float>        value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     float               disabled_value = 0.0f;
 };
 
@@ -458,7 +487,7 @@ struct mvInputDoubleConfig
     ImGuiInputTextFlags flags = 0;
     ImGuiInputTextFlags stor_flags = 0;
     double              last_value = 0.0;
-    std::shared_ptr<double>        value = std::make_shared<double>(0.0);
+    std::shared_ptr<std::atomic<double>> value = std::make_shared<std::atomic<double>>(0.0);
     double              disabled_value = 0.0;
 };
 
@@ -519,7 +548,7 @@ struct mvTextConfig
 struct mvSelectableConfig
 {
     ImGuiSelectableFlags flags = ImGuiSelectableFlags_None;
-    std::shared_ptr<bool>          value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool                 disabled_value = false;
 };
 
@@ -532,14 +561,14 @@ struct mvMenuItemConfig
 {
     std::string shortcut;
     bool        check = false;
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool        disabled_value = false;
 };
 
 struct mvProgressBarConfig
 {
     std::string  overlay;
-    std::shared_ptr<float> value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     float        disabled_value = 0.0f;
 };
 
@@ -571,6 +600,16 @@ struct mvImageButtonConfig
 struct mvFilterSetConfig
 {
     ImGuiTextFilter imguiFilter;
+    bool            indexed = false; // resolve new filters through a trigram index of child keys
+
+    // cached state (pass/fail is only recomputed when the filter text,
+    // the set of children or a child's filter_key changes)
+    std::vector<mvAppItem*>                    children; // child snapshot the cache was built for, rebuilt when dirty
+    std::vector<int>                           passing;  // indices into children
+    std::string                                appliedFilter;
+    bool                                       dirty = true;
+    std::unordered_map<u32, std::vector<int>>  trigrams;
+    bool                                       indexDirty = true;
 };
 
 struct mvTooltipConfig
@@ -581,7 +620,7 @@ struct mvTooltipConfig
 
 struct mvKnobFloatConfig
 {
-    std::shared_ptr<float> value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     float        disabled_value = 0.0f;
     float        minv = 0.0f;
     float        maxv = 100.0f;
@@ -1055,8 +1094,13 @@ public:
     mvFilterSetConfig configData{};
     explicit mvFilterSet(mvUUID uuid) : mvAppItem(uuid) {}
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_filter_set(drawlist, *this, configData); }
+    void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
+    void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
     void setPyValue(PyObject* value) override;
     PyObject* getPyValue() override { return ToPyString(std::string(configData.imguiFilter.InputBuf)); }
+    void onChildAdd(std::shared_ptr<mvAppItem> item) { configData.dirty = true; }
+    void onChildRemoved(std::shared_ptr<mvAppItem> item) { configData.dirty = true; }
+    void onChildrenRemoved() { configData.dirty = true; } // also used when children are reordered
 };
 
 class mvTooltip : public mvAppItem
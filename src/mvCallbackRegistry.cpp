@@ -100,6 +100,37 @@ mvCallbackJob::mvCallbackJob(mvPyObjectStrictPtr callback, mvAppItem& item, mvAp
 		sender = 0;
 		sender_str = item.config.alias;
 	}
+
+	if (item.config.nativeCallback && cwd.callback.get() == &item.config.callback)
+	{
+		native.callback = item.config.nativeCallback;
+		native.sender = item.uuid;
+		native.user = item.config.nativeUserData;
+
+		// copied now, the value may change again before the call
+		void* value = item.getValue();
+		switch (value ? DearPyGui::GetEntityValueType(item.type) : StorageValueTypes::None)
+		{
+		case StorageValueTypes::Bool:
+			native.appData.type = mvNativeData_Bool;
+			native.appData.b = (*static_cast<std::shared_ptr<std::atomic<bool>>*>(value))->load() ? 1 : 0;
+			break;
+		case StorageValueTypes::Int:
+			native.appData.type = mvNativeData_Int;
+			native.appData.i = (*static_cast<std::shared_ptr<std::atomic<int>>*>(value))->load();
+			break;
+		case StorageValueTypes::Float:
+			native.appData.type = mvNativeData_Float;
+			native.appData.f = (*static_cast<std::shared_ptr<std::atomic<float>>*>(value))->load();
+			break;
+		case StorageValueTypes::Double:
+			native.appData.type = mvNativeData_Double;
+			native.appData.d = (*static_cast<std::shared_ptr<std::atomic<double>>*>(value))->load();
+			break;
+		default:
+			break;
+		}
+	}
 }
 
 void mvCallbackJob::prepare()
@@ -203,6 +234,12 @@ void mvAddCallbackJob(mvCallbackJob&& job, bool allowManualManagement)
 		return;
 	}
 
+	// native callbacks skip the queue (and manual management), no GIL needed
+	if (job.is_native()) {
+		job.native.callback(job.native.sender, &job.native.appData, job.native.user);
+		return;
+	}
+
 	if (GContext->callbackRegistry->callCount > GContext->callbackRegistry->maxNumberOfCalls)
 	{
 		assert(false);
@@ -229,6 +266,13 @@ void mvRunCallbackJob(mvCallbackJob&& job)
 		return;
 	}
 
+	if (job.is_native()) {
+		Py_BEGIN_ALLOW_THREADS;
+		job.native.callback(job.native.sender, &job.native.appData, job.native.user);
+		Py_END_ALLOW_THREADS;
+		return;
+	}
+
 	job.prepare();
 	auto callback = job.cwd.callback->copy();
 	auto appData = job.cwd.appData->copy();
@@ -283,6 +283,78 @@ static PyObject* SanitizeCallback(PyObject* callback)
 // forward declaration: mvCallbackRegistry.h is included in mvAppItem.h
 class mvAppItem;
 
+//-----------------------------------------------------------------------------
+// native callbacks
+//   * an item's callback may be a PyCapsule named MV_NATIVE_CALLBACK_CAPSULE
+//     wrapping a mvNativeCallback (e.g. a C extension or a ctypes/cffi
+//     function pointer).
+//   * it is called without the GIL on the thread that raised the callback,
+//     usually the render thread, instead of queueing a python call. It must
+//     return quickly and must not call into python.
+//   * sender is the item's uuid, user is the capsule's context
+//     (PyCapsule_SetContext) and must outlive the item.
+//   * app_data is a copy of the item's value when it is a bool/int/float/
+//     double. Global handlers pass their event instead: the key or button
+//     code (Int) for press/release/click/double click, the wheel delta (Int),
+//     (code, duration) for key/mouse down, (button, dx, dy) for drag and
+//     (x, y) for mouse move (Vec). Anything else is mvNativeData_None.
+//   * the C signature, for ctypes/cffi users:
+//         void callback(uint64_t sender, const mvNativeAppData* app_data, void* user);
+//         struct mvNativeAppData { int type; union { int b; int i; float f; double d; float v[4]; }; };
+//-----------------------------------------------------------------------------
+#define MV_NATIVE_CALLBACK_CAPSULE "dearpygui.native_callback"
+
+enum mvNativeDataType
+{
+    mvNativeData_None = 0,
+    mvNativeData_Bool,
+    mvNativeData_Int,
+    mvNativeData_Float,
+    mvNativeData_Double,
+    mvNativeData_Vec     // up to 4 floats in v, unused ones are 0
+};
+
+struct mvNativeAppData
+{
+    int type = mvNativeData_None; // mvNativeDataType
+    union
+    {
+        int    b;
+        int    i;
+        float  f;
+        double d;
+        float  v[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+};
+
+inline mvNativeAppData
+mvNativeInt(int value)
+{
+    mvNativeAppData data;
+    data.type = mvNativeData_Int;
+    data.i = value;
+    return data;
+}
+
+inline mvNativeAppData
+mvNativeVec(float x, float y, float z = 0.0f, float w = 0.0f)
+{
+    mvNativeAppData data;
+    data.type = mvNativeData_Vec;
+    data.v[0] = x; data.v[1] = y; data.v[2] = z; data.v[3] = w;
+    return data;
+}
+
+typedef void (*mvNativeCallback)(unsigned long long sender, const mvNativeAppData* app_data, void* user);
+
+struct mvNativeJob
+{
+    mvNativeCallback callback = nullptr;
+    mvUUID           sender = 0;
+    mvNativeAppData  appData;
+    void*            user = nullptr;
+};
+
 using mvAppDataVariant = std::variant<mvPyObjectStrictPtr, std::function<PyObject*()>, std::nullptr_t>;
 #define MV_APP_DATA_FUNC(x) [=](){return x;}
 #define MV_APP_DATA_COPY_FUNC(x) [=](){Py_XINCREF(**(x)); return **(x);}
@@ -294,6 +366,7 @@ public:
     mvUUID sender = 0;
     std::string sender_str;
     std::function<PyObject*()> makeAppData;
+    mvNativeJob native; // when set, called in place of cwd.callback
     bool valid = true;
 
     mvCallbackJob(mvCallbackWithData&& wrapper, mvUUID sender, std::string sender_str, std::function<PyObject*()> makeAppData = nullptr, bool valid = true);
@@ -328,6 +401,7 @@ public:
         sender = other.sender;
         sender_str = other.sender_str;
         makeAppData = std::move(other.makeAppData);
+        native = other.native;
         valid = other.valid;
         other.valid = false;
     }
@@ -338,6 +412,7 @@ public:
         sender = other.sender;
         sender_str = other.sender_str;
         makeAppData = std::move(other.makeAppData);
+        native = other.native;
         valid = other.valid;
         other.valid = false;
         return *this;
@@ -345,7 +420,9 @@ public:
 
     mvCallbackJob copy()
     {
-        return mvCallbackJob(cwd.copy(), sender, sender_str, makeAppData, valid);
+        mvCallbackJob job(cwd.copy(), sender, sender_str, makeAppData, valid);
+        job.native = native;
+        return job;
     }
 
     void prepare();
@@ -357,6 +434,8 @@ public:
         return !cwd.callback || !*cwd.callback;
     }
 
+    bool is_native() const { return native.callback != nullptr; }
+
     static PyObject* to_python_tuple(mvCallbackJob&& job);
 };
 
@@ -429,8 +508,20 @@ std::future<typename std::invoke_result<F, Args...>::type> mvSubmitCallback(F f)
 	return res;
 }
 
+inline std::future<void> mvRunNativeCallbackJob(mvCallbackJob& job)
+{
+	// called in place on the raising thread, never queued and without the GIL
+	job.native.callback(job.native.sender, &job.native.appData, job.native.user);
+	std::promise<void> done;
+	done.set_value();
+	return done.get_future();
+}
+
 inline std::future<void> mvSubmitAddCallbackJob(mvCallbackJob&& job)
 {
+	if (job.is_native())
+		return mvRunNativeCallbackJob(job);
+
 	// This gets wrapped in an std::function so it can't be move-only, sadly.
 	auto jobp = std::make_shared<mvCallbackJob>(std::move(job));
 
@@ -441,6 +532,9 @@ inline std::future<void> mvSubmitAddCallbackJob(mvCallbackJob&& job)
 
 inline std::future<void> mvSubmitRunCallbackJob(mvCallbackJob&& job)
 {
+	if (job.is_native())
+		return mvRunNativeCallbackJob(job);
+
 	// This gets wrapped in an std::function so it can't be move-only, sadly.
 	auto jobp = std::make_shared<mvCallbackJob>(std::move(job));
 
@@ -519,8 +519,10 @@ DearPyGui::draw_color_map_slider(ImDrawList* drawlist, mvAppItem& item, mvColorM
 	{
 		ScopedID id(item.uuid);
 
-		if (ImPlot::ColormapSlider(item.info.internalLabel.c_str(), config.value.get(), &config.color, "", config.colorMap))
+		float value = *config.value;
+		if (ImPlot::ColormapSlider(item.info.internalLabel.c_str(), &value, &config.color, "", config.colorMap))
 		{
+			*config.value = value;
 			mvSubmitAddCallbackJob({item, MV_APP_DATA_FUNC(ToPyFloat(*config.value))});
 		}
 	}
@@ -898,7 +900,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvColorMapSliderC
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<float>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<float>>*>(srcItem->getValue());
 
 }
 
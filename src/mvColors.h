@@ -116,7 +116,7 @@ struct mvColorMapScaleConfig
 
 struct mvColorMapSliderConfig
 {
-    std::shared_ptr<float>    value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> value = std::make_shared<std::atomic<float>>(0.0f);
     ImVec4          color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
     ImPlotColormap  colorMap = 0;
 };
@@ -470,7 +470,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvMenuConfig& out
                            "Values types do not match: " + std::to_string(dataSource), &item);
         return;
     }
-    outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+    outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -492,7 +492,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvTabConfig& outC
             "Values types do not match: " + std::to_string(dataSource), &item);
         return;
     }
-    outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+    outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -514,7 +514,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvTreeNodeConfig&
             "Values types do not match: " + std::to_string(dataSource), &item);
         return;
     }
-    outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+    outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 void
@@ -558,7 +558,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvCollapsingHeade
             "Values types do not match: " + std::to_string(dataSource), &item);
         return;
     }
-    outConfig.value = *static_cast<std::shared_ptr<bool>*>(srcItem->getValue());
+    outConfig.value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(srcItem->getValue());
 }
 
 //-----------------------------------------------------------------------------
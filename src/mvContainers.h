@@ -67,13 +67,13 @@ namespace DearPyGui
 
 struct mvMenuConfig
 {
-    std::shared_ptr<bool> value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool        _disabled_value = false;
 };
 
 struct mvTabConfig
 {
-    std::shared_ptr<bool>       value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool              closable = false;
     bool              _disabled_value = false;
     ImGuiTabItemFlags _flags = ImGuiTabItemFlags_None;
@@ -102,7 +102,7 @@ struct mvChildWindowConfig
 
 struct mvTreeNodeConfig
 {
-    std::shared_ptr<bool>        value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool               disabled_value = false;
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_None;
     bool               selectable = false;
@@ -124,7 +124,7 @@ struct mvDragPayloadConfig
 
 struct mvCollapsingHeaderConfig
 {
-    std::shared_ptr<bool>        value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> value = std::make_shared<std::atomic<bool>>(false);
     bool               disabled_value = false;
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_None;
     bool               closable = false;
@@ -5,6 +5,8 @@
 #include <thread>
 #include <future>
 #include <chrono>
+#include <cmath>
+#include <algorithm>
 #include "mvProfiler.h"
 #include <implot.h>
 #include "mvFontManager.h"
@@ -191,10 +193,17 @@ Render()
     // route input callbacks
     UpdateInputs(GContext->input);
 
+    // diffed once for the global handlers, also tells adaptive frame pacing about activity
+    mvUpdateInputEvents();
+    if (mvGetInputEvents().any)
+        GContext->inputTime = GContext->time;
+
     mvToolManager::Draw();
 
     {
         std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+        mvRecordInputFrame(GContext->inputRecorder);
+
         if (GContext->resetTheme)
         {
             SetDefaultTheme();
@@ -202,6 +211,7 @@ Render()
         }
 
         mvRunTasks();
+
         RenderItemRegistry(*GContext->itemRegistry);
         mvRunTasks();
     }
@@ -210,10 +220,65 @@ Render()
         GContext->waitOneFrame = false;
 }
 
-std::map<std::string, mvPythonParser>& 
+void
+mvPaceFrame(mvViewport& viewport)
+{
+    using clock = std::chrono::steady_clock;
+    mvFramePacing& pacing = viewport.pacing;
+
+    f64 target = viewport.minFrameTime;
+    if (viewport.maxFps > 0.0f)
+        target = std::max(target, 1.0 / viewport.maxFps);
+    if (viewport.adaptiveFps && viewport.idleFps > 0.0f)
+    {
+        bool idle = GContext->time - GContext->inputTime > viewport.idleTime;
+        if (!viewport.focused || viewport.minimized || idle)
+            target = std::max(target, 1.0 / viewport.idleFps);
+    }
+    pacing.targetTime = target;
+    mvSetTimerResolution(viewport, target > 0.0);
+
+    clock::time_point now = clock::now();
+    if (pacing.lastFrame == clock::time_point())
+    {
+        pacing.lastFrame = now;
+        return;
+    }
+
+    if (target > 0.0)
+    {
+        clock::time_point deadline = pacing.lastFrame + std::chrono::duration_cast<clock::duration>(std::chrono::duration<f64>(target));
+
+        // sleep in short slices while a slice can't overshoot the deadline,
+        // then spin the remainder, sleep granularity is 1-15ms depending on the OS
+        for (;;)
+        {
+            f64 remaining = std::chrono::duration<f64>(deadline - now).count();
+            f64 margin = pacing.sleepMean + 2.0 * std::sqrt(pacing.sleepVariance);
+            if (remaining <= margin)
+                break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            clock::time_point woke = clock::now();
+            f64 slept = std::chrono::duration<f64>(woke - now).count();
+            f64 delta = slept - pacing.sleepMean;
+            pacing.sleepMean += 0.05 * delta;
+            pacing.sleepVariance = 0.95 * (pacing.sleepVariance + 0.05 * delta * delta);
+            now = woke;
+        }
+        while (now < deadline)
+            now = clock::now();
+    }
+
+    pacing.frameTimes[pacing.nextFrame] = std::chrono::duration<f64>(now - pacing.lastFrame).count();
+    pacing.nextFrame = (pacing.nextFrame + 1) % IM_ARRAYSIZE(pacing.frameTimes);
+    pacing.frameCount = std::min(pacing.frameCount + 1, (i32)IM_ARRAYSIZE(pacing.frameTimes));
+    pacing.lastFrame = now;
+}
+
+mvParserRegistry& 
 GetParsers()
 { 
-    return const_cast<std::map<std::string, mvPythonParser>&>(GetModuleParsers());
+    return GetModuleParserRegistry();
 }
 
 void 
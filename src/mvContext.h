@@ -13,6 +13,7 @@
 #include "mvPyUtils.h"
 #include "mvTypes.h"
 #include "mvGraphics.h"
+#include "mvInputRecorder.h"
 
 //-----------------------------------------------------------------------------
 // forward declarations
@@ -33,7 +34,7 @@ extern mvContext* GContext;
 mvUUID                                 GenerateUUID();
 void                                   SetDefaultTheme();
 void                                   Render();
-std::map<std::string, mvPythonParser>& GetParsers();
+mvParserRegistry&                      GetParsers();
 
 struct mvInput
 {
@@ -84,6 +85,7 @@ struct mvIO
     bool        loadIniFile = false;
     bool        autoSaveIniFile = false;
     bool        waitForInput = false;
+    std::string fontAtlasCache; // existing directory for cached font atlases (disabled if empty)
 
     // GPU selection
     bool        info_auto_device = false;
@@ -111,6 +113,7 @@ struct mvContext
     double              time      = 0.0;    // total time since starting
     int                 frame     = 0;      // frame count
     int                 framerate = 0;      // frame rate
+    double              inputTime = 0.0;    // time of the last mouse/keyboard activity
     mvUUID              id = MV_START_UUID; // current ID
     mvViewport*         viewport = nullptr;
     mvGraphics          graphics;
@@ -119,6 +122,7 @@ struct mvContext
     mvItemRegistry*     itemRegistry = nullptr;
     mvCallbackRegistry* callbackRegistry = nullptr;
     mvInput             input;
+    mvInputRecorder     inputRecorder;
     mvUUID              activeWindow = 0;
     mvUUID              focusedItem = 0;
 
@@ -10,9 +10,6 @@ mvDebugWindow::mvDebugWindow()
 
     m_width = 700;
     m_height = 500;
-
-    for (const auto& item : GetModuleParsers())
-        m_commands.emplace_back(item.first, item.second.documentation);
 }
 
 void mvDebugWindow::drawWidgets()
@@ -20,6 +17,14 @@ void mvDebugWindow::drawWidgets()
 
     static std::string commandstring;
 
+    // command docs are gathered on first draw so parsers stay lazy
+    if (!m_setup)
+    {
+        for (const auto& item : GetModuleParsers())
+            m_commands.emplace_back(item.first, item.second.documentation);
+        m_setup = true;
+    }
+
     ImGuiIO& io = ImGui::GetIO();
 
         static size_t commandselection = 0;
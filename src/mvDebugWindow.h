@@ -20,5 +20,6 @@ protected:
 private:
 
     std::vector<std::pair<std::string, std::string>> m_commands;
+    bool                                             m_setup = false;
 
 };
\ No newline at end of file
@@ -8,11 +8,11 @@ mvDocWindow::mvDocWindow()
     m_windowflags = ImGuiWindowFlags_NoSavedSettings;
     m_width = 700;
     m_height = 500;
-    setup();
 }
 
 void mvDocWindow::setup()
 {
+    m_setup = true;
 
     const std::map<std::string, mvPythonParser>& docmap = GetModuleParsers();
     const std::vector<std::pair<std::string, long>>& constants = GetModuleConstants();
@@ -61,6 +61,9 @@ void mvDocWindow::setup()
 void mvDocWindow::drawWidgets()
 {
 
+    if (!m_setup)
+        setup();
+
     if (ImGui::BeginTabBar("Main Tabbar##doc"))
     {
         if (ImGui::BeginTabItem("Commands##doc"))
@@ -22,6 +22,9 @@ private:
 
 	void setup();
 
+	// command docs are gathered on first draw so parsers stay lazy
+	bool m_setup = false;
+
 	int categorySelection = 0;
 	const char* m_doc = "None";
 
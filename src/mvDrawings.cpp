@@ -6,6 +6,165 @@
 #include "mvContext.h"
 #include "mvCustomTypes.h"
 
+// returns true if the cache was built with the same draw info;
+// otherwise adopts the new draw info and returns false
+static bool
+IsDrawCacheValid(mvDrawCache& cache, const mvAppItemDrawInfo& info)
+{
+	if (!cache.dirty
+		&& memcmp(&cache.info.transform, &info.transform, sizeof(mvMat4)) == 0
+		&& cache.info.perspectiveDivide == info.perspectiveDivide
+		&& cache.info.depthClipping == info.depthClipping
+		&& memcmp(cache.info.clipViewport, info.clipViewport, sizeof(info.clipViewport)) == 0)
+		return true;
+
+	cache.info = info;
+	cache.dirty = false;
+	return false;
+}
+
+// transform, perspective divide and clip test into cache.points
+static void
+UpdateDrawCachePoints(mvDrawCache& cache, const mvVec4* points, size_t count)
+{
+	cache.points.resize(count);
+	cache.clipped = count > 0 && mvTransformPoints(cache.info.transform, &points[0].x, 4, 4, count,
+		cache.info.perspectiveDivide, cache.info.depthClipping ? cache.info.clipViewport : nullptr,
+		nullptr, cache.points.data()) > 0;
+}
+
+// transforms a draw item's control points in place with one batched call
+// (instead of a matrix product and divide per point); returns true if
+// depth clipping rejects any of them
+static bool
+TransformDrawPoints(const mvAppItemDrawInfo& info, mvVec4* points, size_t count)
+{
+	return mvTransformPoints(info.transform, &points[0].x, 4, 4, count, info.perspectiveDivide,
+		info.depthClipping ? info.clipViewport : nullptr, points) > 0;
+}
+
+// maps transformed points into screen space, reusing cache.screen
+static void
+ProjectDrawCache(mvDrawCache& cache, const std::vector<ImVec2>& points, float x, float y)
+{
+	cache.screen.resize(points.size());
+
+	if (ImPlot::GetCurrentContext()->CurrentPlot)
+	{
+		for (size_t i = 0; i < points.size(); i++)
+			cache.screen[i] = ImPlot::PlotToPixels(points[i].x, points[i].y);
+	}
+	else
+	{
+		for (size_t i = 0; i < points.size(); i++)
+			cache.screen[i] = ImVec2(points[i].x + x, points[i].y + y);
+	}
+}
+
+// segment count for cached curves when the item doesn't specify one,
+// based on the screen length of the control polygon (multiples of 8 so
+// zooming doesn't retessellate every frame)
+static int
+GetCurveSegments(const mvDrawCache& cache)
+{
+	if (cache.points.size() < 2)
+		return 1;
+
+	bool plot = ImPlot::GetCurrentContext()->CurrentPlot != nullptr;
+	float length = 0.0f;
+	ImVec2 last = plot ? ImPlot::PlotToPixels(cache.points[0].x, cache.points[0].y) : cache.points[0];
+	for (size_t i = 1; i < cache.points.size(); i++)
+	{
+		ImVec2 current = plot ? ImPlot::PlotToPixels(cache.points[i].x, cache.points[i].y) : cache.points[i];
+		length += sqrtf((current.x - last.x) * (current.x - last.x) + (current.y - last.y) * (current.y - last.y));
+		last = current;
+	}
+
+	int segments = ((int)(length / 8.0f) + 7) & ~7;
+	return segments < 8 ? 8 : (segments > 128 ? 128 : segments);
+}
+
+static float
+TriangleArea2(const ImVec2& a, const ImVec2& b, const ImVec2& c)
+{
+	return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+// ear clipping triangulation of a concave or self touching polygon
+static void
+TriangulatePolygon(const std::vector<ImVec2>& points, std::vector<int>& indices)
+{
+	indices.clear();
+
+	int n = (int)points.size();
+
+	// the closing point is usually repeated
+	if (n > 1 && points[0].x == points[n - 1].x && points[0].y == points[n - 1].y)
+		n--;
+
+	if (n < 3)
+		return;
+
+	float area = 0.0f;
+	for (int i = 0, j = n - 1; i < n; j = i++)
+		area += points[j].x * points[i].y - points[i].x * points[j].y;
+	const float winding = area >= 0.0f ? 1.0f : -1.0f;
+
+	std::vector<int> remaining(n);
+	for (int i = 0; i < n; i++)
+		remaining[i] = i;
+	indices.reserve((n - 2) * 3);
+
+	int i = 0;
+	int misses = 0;
+	while (remaining.size() > 3)
+	{
+		const int count = (int)remaining.size();
+		const int prev = remaining[(i + count - 1) % count];
+		const int curr = remaining[i];
+		const int next = remaining[(i + 1) % count];
+		const ImVec2& a = points[prev];
+		const ImVec2& b = points[curr];
+		const ImVec2& c = points[next];
+
+		bool ear = TriangleArea2(a, b, c) * winding > 0.0f;
+		for (int k = 0; ear && k < count; k++)
+		{
+			const ImVec2& p = points[remaining[k]];
+
+			// shared vertices of self touching polygons don't block an ear
+			if ((p.x == a.x && p.y == a.y) || (p.x == b.x && p.y == b.y) || (p.x == c.x && p.y == c.y))
+				continue;
+
+			if (TriangleArea2(a, b, p) * winding >= 0.0f
+				&& TriangleArea2(b, c, p) * winding >= 0.0f
+				&& TriangleArea2(c, a, p) * winding >= 0.0f)
+				ear = false;
+		}
+
+		// no ear left means degenerate input; clip anyway instead of spinning
+		if (ear || misses >= count)
+		{
+			indices.push_back(prev);
+			indices.push_back(curr);
+			indices.push_back(next);
+			remaining.erase(remaining.begin() + i);
+			if (i >= (int)remaining.size())
+				i = 0;
+			misses = 0;
+		}
+		else
+		{
+			i = (i + 1) % count;
+			misses++;
+		}
+	}
+
+	indices.push_back(remaining[0]);
+	indices.push_back(remaining[1]);
+	indices.push_back(remaining[2]);
+}
+
 mvDrawArrow::mvDrawArrow(mvUUID uuid)
 	:
 	mvAppItem(uuid)
@@ -52,42 +211,14 @@ void mvDrawArrow::updatePoints()
 void mvDrawArrow::draw(ImDrawList* drawlist, float x, float y)
 {
 
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-
-	mvVec4  tpp1 = drawInfo->transform * _points[0];
-	mvVec4  tpp2 = drawInfo->transform * _points[1];
-	mvVec4  tpp3 = drawInfo->transform * _points[2];
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-		tpp1.x = tpp1.x / tpp1.w;
-		tpp2.x = tpp2.x / tpp2.w;
-		tpp3.x = tpp3.x / tpp3.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-		tpp1.y = tpp1.y / tpp1.w;
-		tpp2.y = tpp2.y / tpp2.w;
-		tpp3.y = tpp3.y / tpp3.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-		tpp1.z = tpp1.z / tpp1.w;
-		tpp2.z = tpp2.z / tpp2.w;
-		tpp3.z = tpp3.z / tpp3.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tpp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tpp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tpp3)) return;
-	}
+	mvVec4 points[] = { _p1, _p2, _points[0], _points[1], _points[2] };
+	if (TransformDrawPoints(*drawInfo, points, 5))
+		return;
+	mvVec4& tp1 = points[0];
+	mvVec4& tp2 = points[1];
+	mvVec4& tpp1 = points[2];
+	mvVec4& tpp2 = points[3];
+	mvVec4& tpp3 = points[4];
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 	{
@@ -147,48 +278,451 @@ void mvDrawArrow::getSpecificConfiguration(PyObject* dict)
 	PyDict_SetItemString(dict, "size", mvPyObject(ToPyFloat(_size)));
 }
 
-void mvDrawBezierCubic::draw(ImDrawList* drawlist, float x, float y)
+template<typename T>
+static void
+ReleaseBatchColumn(mvDrawBatchColumn<T>& column)
+{
+	if (column.viewHeld)
+	{
+		PyBuffer_Release(&column.view);
+		column.viewHeld = false;
+	}
+	column.owned.clear();
+	column.data = nullptr;
+	column.rows = 0;
+}
+
+static bool
+IsBatchFloatFormat(const Py_buffer& view)
 {
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-	mvVec4  tp3 = drawInfo->transform * _p3;
-	mvVec4  tp4 = drawInfo->transform * _p4;
+	return view.itemsize == 4 && strcmp(view.format, "f") == 0;
+}
 
-	if (drawInfo->perspectiveDivide)
+static bool
+IsBatchColorFormat(const Py_buffer& view)
+{
+	// packed ImU32 colors (numpy uint32)
+	return view.itemsize == 4 && (strcmp(view.format, "I") == 0 || strcmp(view.format, "L") == 0 || strcmp(view.format, "k") == 0);
+}
+
+// flattens a column into floats, "width" components per row
+static std::vector<float>
+ReadBatchRows(PyObject* value, int width)
+{
+	bool nested = false;
+	if (PyList_Check(value) && PyList_Size(value) > 0)
+		nested = PySequence_Check(PyList_GetItem(value, 0));
+	else if (PyTuple_Check(value) && PyTuple_Size(value) > 0)
+		nested = PySequence_Check(PyTuple_GetItem(value, 0));
+
+	if (!nested)
+		return ToFloatVect(value);
+
+	std::vector<mvVec4> points = ToVectVec4(value);
+	std::vector<float> result;
+	result.reserve(points.size() * width);
+	for (auto& point : points)
 	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-		tp3.x = tp3.x / tp3.w;
-		tp4.x = tp4.x / tp4.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-		tp3.y = tp3.y / tp3.w;
-		tp4.y = tp4.y / tp4.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-		tp3.z = tp3.z / tp3.w;
-		tp4.z = tp4.z / tp4.w;
+		for (int i = 0; i < width; i++)
+			result.push_back(point[i]);
 	}
+	return result;
+}
 
+static std::vector<ImU32>
+ReadBatchColors(PyObject* value)
+{
+	std::vector<ImU32> result;
 
-	if (drawInfo->depthClipping)
+	if (PyObject_CheckBuffer(value))
 	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp3)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp4)) return;
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0)
+		{
+			bool packed = IsBatchColorFormat(view);
+			if (packed)
+			{
+				result.resize(view.len / view.itemsize);
+				memcpy(result.data(), view.buf, view.len);
+			}
+			PyBuffer_Release(&view);
+			if (packed)
+				return result;
+		}
+		else
+		{
+			PyErr_Clear();
+			mvThrowPythonError(mvErrorCode::mvWrongType, "Batch colors must be a C-contiguous buffer.");
+			return result;
+		}
+
+		// rgba rows in 0-255
+		std::vector<float> components = ToFloatVect(value);
+		result.reserve(components.size() / 4);
+		for (size_t i = 0; i + 3 < components.size(); i += 4)
+			result.push_back(mvColor(components[i] / 255.0f, components[i + 1] / 255.0f, components[i + 2] / 255.0f, components[i + 3] / 255.0f));
+		return result;
 	}
 
-	if (ImPlot::GetCurrentContext()->CurrentPlot)
-		drawlist->AddBezierCubic(ImPlot::PlotToPixels(tp1), ImPlot::PlotToPixels(tp2), ImPlot::PlotToPixels(tp3),
-			ImPlot::PlotToPixels(tp4), _color, ImPlot::GetCurrentContext()->Mx * _thickness, _segments);
+	if (PyList_Check(value))
+	{
+		result.reserve(PyList_Size(value));
+		for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
+			result.push_back(ToColor(PyList_GetItem(value, i)));
+	}
+	else if (PyTuple_Check(value))
+	{
+		result.reserve(PyTuple_Size(value));
+		for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
+			result.push_back(ToColor(PyTuple_GetItem(value, i)));
+	}
 	else
+		mvThrowPythonError(mvErrorCode::mvWrongType, "Batch colors must be a uint32 buffer, an Nx4 buffer or a list of colors.");
+
+	return result;
+}
+
+static void
+SetBatchColumn(mvDrawBatchColumn<float>& column, PyObject* value, int minWidth, int maxWidth)
+{
+	ReleaseBatchColumn(column);
+	column.width = minWidth;
+
+	if (value == Py_None)
+		return;
+
+	if (PyObject_CheckBuffer(value))
 	{
-		mvVec2 start = { x, y };
-		drawlist->AddBezierCubic(tp1 + start, tp2 + start, tp3 + start, tp4 + start, _color, _thickness, _segments);
+		if (PyObject_GetBuffer(value, &column.view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+		{
+			PyErr_Clear();
+			mvThrowPythonError(mvErrorCode::mvWrongType, "Batch column must be a C-contiguous buffer.");
+			return;
+		}
+
+		int width = column.view.ndim == 2 ? (int)column.view.shape[1] : minWidth;
+		if (width < minWidth || width > maxWidth)
+		{
+			PyBuffer_Release(&column.view);
+			mvThrowPythonError(mvErrorCode::mvWrongType, "Batch column has " + std::to_string(width) + " components per row.");
+			return;
+		}
+		column.width = width;
+
+		// matching layout: draw straight out of the exporter's memory
+		if (IsBatchFloatFormat(column.view))
+		{
+			column.viewHeld = true;
+			column.data = (float*)column.view.buf;
+			column.rows = column.view.len / column.view.itemsize / width;
+			return;
+		}
+
+		PyBuffer_Release(&column.view);
+		column.owned = ToFloatVect(value);
+	}
+	else
+		column.owned = ReadBatchRows(value, minWidth);
+
+	column.data = column.owned.data();
+	column.rows = column.owned.size() / column.width;
+}
+
+static void
+SetBatchColorColumn(mvDrawBatchColumn<ImU32>& column, PyObject* value)
+{
+	ReleaseBatchColumn(column);
+
+	if (value == Py_None)
+		return;
+
+	if (PyObject_CheckBuffer(value))
+	{
+		if (PyObject_GetBuffer(value, &column.view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+		{
+			PyErr_Clear();
+			mvThrowPythonError(mvErrorCode::mvWrongType, "Batch column must be a C-contiguous buffer.");
+			return;
+		}
+
+		if (IsBatchColorFormat(column.view) && column.view.ndim <= 1)
+		{
+			column.viewHeld = true;
+			column.data = (ImU32*)column.view.buf;
+			column.rows = column.view.len / column.view.itemsize;
+			return;
+		}
+		PyBuffer_Release(&column.view);
+	}
+
+	column.owned = ReadBatchColors(value);
+	column.data = column.owned.data();
+	column.rows = column.owned.size();
+}
+
+template<typename T>
+static void
+UpdateBatchColumn(mvDrawBatchColumn<T>& column, size_t start, const std::vector<T>& values)
+{
+	size_t rows = values.size() / column.width;
+	if (rows == 0)
+		return;
+
+	if (column.viewHeld)
+	{
+		if (column.view.readonly || start + rows > column.rows)
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "Batch column range is out of bounds of the bound buffer.");
+			return;
+		}
+	}
+	else if (start + rows > column.rows)
+	{
+		column.owned.resize((start + rows) * column.width);
+		column.data = column.owned.data();
+		column.rows = start + rows;
+	}
+
+	memcpy(column.data + start * column.width, values.data(), rows * column.width * sizeof(T));
+}
+
+// None means "column not supplied"
+static PyObject*
+GetBatchArg(PyObject* dict, const char* name)
+{
+	PyObject* item = PyDict_GetItemString(dict, name);
+	return item == Py_None ? nullptr : item;
+}
+
+mvDrawBatch::~mvDrawBatch()
+{
+	if (_p1.viewHeld || _p2.viewHeld || _p3.viewHeld || _radii.viewHeld || _thicknesses.viewHeld || _colors.viewHeld)
+	{
+		mvGlobalIntepreterLock gil;
+		ReleaseBatchColumn(_p1);
+		ReleaseBatchColumn(_p2);
+		ReleaseBatchColumn(_p3);
+		ReleaseBatchColumn(_radii);
+		ReleaseBatchColumn(_thicknesses);
+		ReleaseBatchColumn(_colors);
+	}
+}
+
+size_t mvDrawBatch::primitiveCount() const
+{
+	size_t count = _p1.rows;
+	if (_kind == mvDrawBatchKind::Lines || _kind == mvDrawBatchKind::Rects || _kind == mvDrawBatchKind::Triangles)
+		count = std::min(count, _p2.rows);
+	if (_kind == mvDrawBatchKind::Triangles)
+		count = std::min(count, _p3.rows);
+
+	// per row columns are optional but must not be overrun
+	if (_radii.data) count = std::min(count, _radii.rows);
+	if (_thicknesses.data) count = std::min(count, _thicknesses.rows);
+	if (_colors.data) count = std::min(count, _colors.rows);
+
+	if (_count >= 0)
+		count = std::min(count, (size_t)_count);
+	return count;
+}
+
+void mvDrawBatch::draw(ImDrawList* drawlist, float x, float y)
+{
+	const size_t count = primitiveCount();
+	if (count == 0)
+		return;
+
+	// state shared by every primitive in the batch
+	const mvMat4 transform = drawInfo->transform;
+	const bool perspectiveDivide = drawInfo->perspectiveDivide;
+	const bool depthClipping = drawInfo->depthClipping;
+	const bool inPlot = ImPlot::GetCurrentContext()->CurrentPlot != nullptr;
+	const float scale = inPlot ? (float)ImPlot::GetCurrentContext()->Mx : 1.0f;
+	const ImU32 defaultColor = _color;
+	const float defaultRadius = _radius;
+	const float defaultThickness = _thickness;
+
+	// project every point column in one pass; plots still map per point
+	// since their axes may be logarithmic
+	const mvDrawBatchColumn<float>* columns[3] = { &_p1, &_p2, &_p3 };
+	const int columnCount = _kind == mvDrawBatchKind::Triangles ? 3
+		: (_kind == mvDrawBatchKind::Lines || _kind == mvDrawBatchKind::Rects) ? 2 : 1;
+	for (int i = 0; i < columnCount; i++)
+	{
+		const mvDrawBatchColumn<float>& column = *columns[i];
+		_screen[i].resize(count);
+		_clipped[i].resize(count);
+		mvTransformPoints(transform, column.data, column.width, column.width, count, perspectiveDivide,
+			depthClipping ? drawInfo->clipViewport : nullptr, nullptr, _screen[i].data(),
+			inPlot ? mvVec2{ 0.0f, 0.0f } : mvVec2{ x, y }, _clipped[i].data());
+		if (inPlot)
+		{
+			for (ImVec2& point : _screen[i])
+				point = ImPlot::PlotToPixels(point.x, point.y);
+		}
+	}
+
+	auto project = [&](int column, size_t row, ImVec2& out)
+	{
+		if (_clipped[column][row])
+			return false;
+		out = _screen[column][row];
+		return true;
+	};
+
+	auto color = [&](size_t row) { return _colors.data ? _colors.data[row] : defaultColor; };
+	auto radius = [&](size_t row) { return scale * (_radii.data ? _radii.data[row] : defaultRadius); };
+	auto thickness = [&](size_t row) { return scale * (_thicknesses.data ? _thicknesses.data[row] : defaultThickness); };
+
+	ImVec2 a, b, c;
+	switch (_kind)
+	{
+
+	case mvDrawBatchKind::Lines:
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!project(0, i, a) || !project(1, i, b)) continue;
+			drawlist->AddLine(a, b, color(i), thickness(i));
+		}
+		break;
+
+	case mvDrawBatchKind::Circles:
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!project(0, i, a)) continue;
+			if (_fill)
+				drawlist->AddCircleFilled(a, radius(i), color(i), _segments);
+			else
+				drawlist->AddCircle(a, radius(i), color(i), _segments, thickness(i));
+		}
+		break;
+
+	case mvDrawBatchKind::Rects:
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!project(0, i, a) || !project(1, i, b)) continue;
+			if (_fill)
+				drawlist->AddRectFilled(a, b, color(i));
+			else
+				drawlist->AddRect(a, b, color(i), 0.0f, ImDrawCornerFlags_All, thickness(i));
+		}
+		break;
+
+	case mvDrawBatchKind::Triangles:
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!project(0, i, a) || !project(1, i, b) || !project(2, i, c)) continue;
+			if (_fill)
+				drawlist->AddTriangleFilled(a, b, c, color(i));
+			else
+				drawlist->AddTriangle(a, b, c, color(i), thickness(i));
+		}
+		break;
+
+	case mvDrawBatchKind::Points:
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!project(0, i, a)) continue;
+			float r = radius(i);
+			drawlist->AddRectFilled(ImVec2(a.x - r, a.y - r), ImVec2(a.x + r, a.y + r), color(i));
+		}
+		break;
+
+	default:
+		break;
 	}
+
+}
+
+void mvDrawBatch::handleSpecificKeywordArgs(PyObject* dict)
+{
+	if (dict == nullptr)
+		return;
+
+	if (PyObject* item = PyDict_GetItemString(dict, "kind")) _kind = (mvDrawBatchKind)ToInt(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "p1")) SetBatchColumn(_p1, item, 2, 3);
+	if (PyObject* item = GetBatchArg(dict, "center")) SetBatchColumn(_p1, item, 2, 3);
+	if (PyObject* item = PyDict_GetItemString(dict, "p2")) SetBatchColumn(_p2, item, 2, 3);
+	if (PyObject* item = PyDict_GetItemString(dict, "p3")) SetBatchColumn(_p3, item, 2, 3);
+	if (PyObject* item = PyDict_GetItemString(dict, "radii")) SetBatchColumn(_radii, item, 1, 1);
+	if (PyObject* item = PyDict_GetItemString(dict, "thicknesses")) SetBatchColumn(_thicknesses, item, 1, 1);
+	if (PyObject* item = PyDict_GetItemString(dict, "colors")) SetBatchColorColumn(_colors, item);
+	if (PyObject* item = PyDict_GetItemString(dict, "color")) _color = ToColor(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "radius")) _radius = ToFloat(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "thickness")) _thickness = ToFloat(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "segments")) _segments = ToInt(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "count")) _count = ToInt(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToBool(item);
+}
+
+void mvDrawBatch::getSpecificConfiguration(PyObject* dict)
+{
+	if (dict == nullptr)
+		return;
+
+	PyDict_SetItemString(dict, "kind", mvPyObject(ToPyInt((int)_kind)));
+	PyDict_SetItemString(dict, "color", mvPyObject(ToPyColor(_color)));
+	PyDict_SetItemString(dict, "radius", mvPyObject(ToPyFloat(_radius)));
+	PyDict_SetItemString(dict, "thickness", mvPyObject(ToPyFloat(_thickness)));
+	PyDict_SetItemString(dict, "segments", mvPyObject(ToPyInt(_segments)));
+	PyDict_SetItemString(dict, "count", mvPyObject(ToPyInt(_count)));
+	PyDict_SetItemString(dict, "fill", mvPyObject(ToPyBool(_fill)));
+	PyDict_SetItemString(dict, "rows", mvPyObject(ToPyInt((int)primitiveCount())));
+}
+
+void mvDrawBatch::updateRange(size_t start, PyObject* dict)
+{
+	if (dict == nullptr)
+		return;
+
+	// the generated wrapper forwards unused columns as None
+	if (PyObject* item = GetBatchArg(dict, "p1")) UpdateBatchColumn(_p1, start, ReadBatchRows(item, _p1.width));
+	if (PyObject* item = GetBatchArg(dict, "center")) UpdateBatchColumn(_p1, start, ReadBatchRows(item, _p1.width));
+	if (PyObject* item = GetBatchArg(dict, "p2")) UpdateBatchColumn(_p2, start, ReadBatchRows(item, _p2.width));
+	if (PyObject* item = GetBatchArg(dict, "p3")) UpdateBatchColumn(_p3, start, ReadBatchRows(item, _p3.width));
+	if (PyObject* item = GetBatchArg(dict, "radii")) UpdateBatchColumn(_radii, start, ReadBatchRows(item, 1));
+	if (PyObject* item = GetBatchArg(dict, "thicknesses")) UpdateBatchColumn(_thicknesses, start, ReadBatchRows(item, 1));
+	if (PyObject* item = GetBatchArg(dict, "colors")) UpdateBatchColumn(_colors, start, ReadBatchColors(item));
+}
+
+void mvDrawBezierCubic::draw(ImDrawList* drawlist, float x, float y)
+{
+	if (!IsDrawCacheValid(_cache, *drawInfo))
+	{
+		mvVec4 points[4] = { _p1, _p2, _p3, _p4 };
+		UpdateDrawCachePoints(_cache, points, 4);
+		_cache.segments = 0;
+	}
+
+	if (_cache.clipped)
+		return;
+
+	int segments = _segments > 0 ? _segments : GetCurveSegments(_cache);
+	if (segments != _cache.segments)
+	{
+		const ImVec2* p = _cache.points.data();
+		_cache.segments = segments;
+		_cache.curve.resize(segments + 1);
+		for (int i = 0; i <= segments; i++)
+		{
+			float t = (float)i / (float)segments;
+			float u = 1.0f - t;
+			float w1 = u * u * u;
+			float w2 = 3.0f * u * u * t;
+			float w3 = 3.0f * u * t * t;
+			float w4 = t * t * t;
+			_cache.curve[i] = ImVec2(
+				w1 * p[0].x + w2 * p[1].x + w3 * p[2].x + w4 * p[3].x,
+				w1 * p[0].y + w2 * p[1].y + w3 * p[2].y + w4 * p[3].y);
+		}
+	}
+
+	ProjectDrawCache(_cache, _cache.curve, x, y);
+
+	if (ImPlot::GetCurrentContext()->CurrentPlot)
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color, false, ImPlot::GetCurrentContext()->Mx * _thickness);
+	else
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color, false, _thickness);
 }
 
 void mvDrawBezierCubic::handleSpecificRequiredArgs(PyObject* dict)
@@ -204,6 +738,8 @@ void mvDrawBezierCubic::handleSpecificRequiredArgs(PyObject* dict)
 	_p2.w = 1.0f;
 	_p3.w = 1.0f;
 	_p4.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawBezierCubic::handleSpecificKeywordArgs(PyObject* dict)
@@ -223,6 +759,8 @@ void mvDrawBezierCubic::handleSpecificKeywordArgs(PyObject* dict)
 	_p2.w = 1.0f;
 	_p3.w = 1.0f;
 	_p4.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawBezierCubic::getSpecificConfiguration(PyObject* dict)
@@ -241,40 +779,41 @@ void mvDrawBezierCubic::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawBezierQuadratic::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-	mvVec4  tp3 = drawInfo->transform * _p3;
-
-	if (drawInfo->perspectiveDivide)
+	if (!IsDrawCacheValid(_cache, *drawInfo))
 	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-		tp3.x = tp3.x / tp3.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-		tp3.y = tp3.y / tp3.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-		tp3.z = tp3.z / tp3.w;
+		mvVec4 points[3] = { _p1, _p2, _p3 };
+		UpdateDrawCachePoints(_cache, points, 3);
+		_cache.segments = 0;
 	}
 
-	if (drawInfo->depthClipping)
+	if (_cache.clipped)
+		return;
+
+	int segments = _segments > 0 ? _segments : GetCurveSegments(_cache);
+	if (segments != _cache.segments)
 	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp3)) return;
+		const ImVec2* p = _cache.points.data();
+		_cache.segments = segments;
+		_cache.curve.resize(segments + 1);
+		for (int i = 0; i <= segments; i++)
+		{
+			float t = (float)i / (float)segments;
+			float u = 1.0f - t;
+			float w1 = u * u;
+			float w2 = 2.0f * u * t;
+			float w3 = t * t;
+			_cache.curve[i] = ImVec2(
+				w1 * p[0].x + w2 * p[1].x + w3 * p[2].x,
+				w1 * p[0].y + w2 * p[1].y + w3 * p[2].y);
+		}
 	}
 
+	ProjectDrawCache(_cache, _cache.curve, x, y);
+
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
-		drawlist->AddBezierQuadratic(ImPlot::PlotToPixels(tp1),
-			ImPlot::PlotToPixels(tp2), ImPlot::PlotToPixels(tp3), _color, ImPlot::GetCurrentContext()->Mx * _thickness, _segments);
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color, false, ImPlot::GetCurrentContext()->Mx * _thickness);
 	else
-	{
-		mvVec2 start = { x, y };
-		drawlist->AddBezierQuadratic(tp1 + start, tp2 + start, tp3 + start, _color, _thickness, _segments);
-	}
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color, false, _thickness);
 }
 
 void mvDrawBezierQuadratic::handleSpecificRequiredArgs(PyObject* dict)
@@ -288,6 +827,8 @@ void mvDrawBezierQuadratic::handleSpecificRequiredArgs(PyObject* dict)
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
 	_p3.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawBezierQuadratic::handleSpecificKeywordArgs(PyObject* dict)
@@ -305,6 +846,8 @@ void mvDrawBezierQuadratic::handleSpecificKeywordArgs(PyObject* dict)
 	_p1.w = 1.0f;
 	_p2.w = 1.0f;
 	_p3.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawBezierQuadratic::getSpecificConfiguration(PyObject* dict)
@@ -322,19 +865,10 @@ void mvDrawBezierQuadratic::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawCircle::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tcenter = drawInfo->transform * _center;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tcenter.x = tcenter.x / tcenter.w;
-		tcenter.y = tcenter.y / tcenter.w;
-		tcenter.z = tcenter.z / tcenter.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tcenter)) return;
-	}
+	mvVec4 points[] = { _center };
+	if (TransformDrawPoints(*drawInfo, points, 1))
+		return;
+	mvVec4& tcenter = points[0];
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 	{
@@ -393,20 +927,6 @@ void mvDrawCircle::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawEllipse::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tpmin = drawInfo->transform * _pmin;
-	mvVec4  tpmax = drawInfo->transform * _pmax;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tpmin.x = tpmin.x / tpmin.w;
-		tpmin.y = tpmin.y / tpmin.w;
-		tpmin.z = tpmin.z / tpmin.w;
-
-		tpmax.x = tpmax.x / tpmax.w;
-		tpmax.y = tpmax.y / tpmax.w;
-		tpmax.z = tpmax.z / tpmax.w;
-	}
-
 	if (_dirty)
 	{
 		if (_segments < 3) { _segments = 3; }
@@ -425,11 +945,9 @@ void mvDrawEllipse::draw(ImDrawList* drawlist, float x, float y)
 		_dirty = false;
 	}
 
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tpmin)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tpmax)) return;
-	}
+	mvVec4 corners[] = { _pmin, _pmax };
+	if (TransformDrawPoints(*drawInfo, corners, 2))
+		return;
 
 	// this is disgusting; we should not be allocating
 	// every frame. Fix ASAP
@@ -437,8 +955,8 @@ void mvDrawEllipse::draw(ImDrawList* drawlist, float x, float y)
 	std::vector<ImVec2> finalpoints;
 	finalpoints.reserve(_points.size());
 
-	for (auto& point : points)
-		point = drawInfo->transform * point;
+	if (!points.empty())
+		mvTransformPoints(drawInfo->transform, &points[0].x, 4, 4, points.size(), false, nullptr, points.data());
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 	{
@@ -531,26 +1049,11 @@ void mvDrawImage::draw(ImDrawList* drawlist, float x, float y)
 		else
 			texture = static_cast<mvDynamicTexture*>(_texture.get())->_texture;
 
-		mvVec4  tpmin = drawInfo->transform * _pmin;
-		mvVec4  tpmax = drawInfo->transform * _pmax;
-
-		if (drawInfo->perspectiveDivide)
-		{
-			tpmin.x = tpmin.x / tpmin.w;
-			tpmax.x = tpmax.x / tpmax.w;
-
-			tpmin.y = tpmin.y / tpmin.w;
-			tpmax.y = tpmax.y / tpmax.w;
-
-			tpmin.z = tpmin.z / tpmin.w;
-			tpmax.z = tpmax.z / tpmax.w;
-		}
-
-		if (drawInfo->depthClipping)
-		{
-			if (mvClipPoint(drawInfo->clipViewport, tpmin)) return;
-			if (mvClipPoint(drawInfo->clipViewport, tpmax)) return;
-		}
+		mvVec4 points[] = { _pmin, _pmax };
+		if (TransformDrawPoints(*drawInfo, points, 2))
+			return;
+		mvVec4& tpmin = points[0];
+		mvVec4& tpmax = points[1];
 
 		if (ImPlot::GetCurrentContext()->CurrentPlot)
 			drawlist->AddImage(texture, ImPlot::PlotToPixels(tpmin), ImPlot::PlotToPixels(tpmax), _uv_min, _uv_max, _color);
@@ -655,36 +1158,13 @@ void mvDrawImageQuad::draw(ImDrawList* drawlist, float x, float y)
 		else
 			texture = static_cast<mvDynamicTexture*>(_texture.get())->_texture;
 
-		mvVec4  tp1 = drawInfo->transform * _p1;
-		mvVec4  tp2 = drawInfo->transform * _p2;
-		mvVec4  tp3 = drawInfo->transform * _p3;
-		mvVec4  tp4 = drawInfo->transform * _p4;
-
-		if (drawInfo->perspectiveDivide)
-		{
-			tp1.x = tp1.x / tp1.w;
-			tp2.x = tp2.x / tp2.w;
-			tp3.x = tp3.x / tp3.w;
-			tp4.x = tp4.x / tp4.w;
-
-			tp1.y = tp1.y / tp1.w;
-			tp2.y = tp2.y / tp2.w;
-			tp3.y = tp3.y / tp3.w;
-			tp4.y = tp4.y / tp4.w;
-
-			tp1.z = tp1.z / tp1.w;
-			tp2.z = tp2.z / tp2.w;
-			tp3.z = tp3.z / tp3.w;
-			tp4.z = tp4.z / tp4.w;
-		}
-
-		if (drawInfo->depthClipping)
-		{
-			if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-			if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-			if (mvClipPoint(drawInfo->clipViewport, tp3)) return;
-			if (mvClipPoint(drawInfo->clipViewport, tp4)) return;
-		}
+		mvVec4 points[] = { _p1, _p2, _p3, _p4 };
+		if (TransformDrawPoints(*drawInfo, points, 4))
+			return;
+		mvVec4& tp1 = points[0];
+		mvVec4& tp2 = points[1];
+		mvVec4& tp3 = points[2];
+		mvVec4& tp4 = points[3];
 
 		if (ImPlot::GetCurrentContext()->CurrentPlot)
 			drawlist->AddImageQuad(texture, ImPlot::PlotToPixels(tp1),
@@ -844,26 +1324,11 @@ void mvDrawLayer::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawLine::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-	}
+	mvVec4 points[] = { _p1, _p2 };
+	if (TransformDrawPoints(*drawInfo, points, 2))
+		return;
+	mvVec4& tp1 = points[0];
+	mvVec4& tp2 = points[1];
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 		drawlist->AddLine(ImPlot::PlotToPixels(tp1), ImPlot::PlotToPixels(tp2), _color,
@@ -982,6 +1447,7 @@ mvDrawNode::~mvDrawNode()
 
 void mvDrawNode::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvMat4 transform = drawInfo->transform * drawInfo->appliedTransform;
 
 	for (auto& item : childslots[2])
 	{
@@ -989,7 +1455,7 @@ void mvDrawNode::draw(ImDrawList* drawlist, float x, float y)
 		if (!item->config.show)
 			continue;
 
-		item->drawInfo->transform = drawInfo->transform * drawInfo->appliedTransform;
+		item->drawInfo->transform = transform;
 
 		item->drawInfo->perspectiveDivide = drawInfo->perspectiveDivide;
 		item->drawInfo->depthClipping = drawInfo->depthClipping;
@@ -1021,133 +1487,34 @@ void mvDrawNode::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawPolygon::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4 start = { x, y };
-
-	// this is disgusting; we should not be allocating
-	// every frame. Fix ASAP
-	std::vector<mvVec4> points = _points;
-	std::vector<ImVec2> finalpoints;
-	finalpoints.reserve(_points.size());
-
-	for (auto& point : points)
-		point = drawInfo->transform * point;
+	if (_points.empty())
+		return;
 
-	if (drawInfo->perspectiveDivide)
+	if (!IsDrawCacheValid(_cache, *drawInfo))
 	{
-
-		for (auto& point : points)
-		{
-			point.x = point.x / point.w;
-			point.y = point.y / point.w;
-			point.z = point.z / point.w;
-		}
+		UpdateDrawCachePoints(_cache, _points.data(), _points.size());
+		TriangulatePolygon(_cache.points, _cache.indices);
 	}
 
-	if (drawInfo->depthClipping)
-	{
-		for (auto& point : points)
-			if (mvClipPoint(drawInfo->clipViewport, point)) return;
-	}
+	if (_cache.clipped)
+		return;
 
-	if (ImPlot::GetCurrentContext()->CurrentPlot)
-	{
-		for (auto& point : points)
-		{
-			ImVec2 impoint = ImPlot::PlotToPixels(point);
-			point.x = impoint.x;
-			point.y = impoint.y;
-			finalpoints.push_back(impoint);
-		}
-	}
-	else
-	{
-		for (auto& point : points)
-		{
-			point = point + start;
-			finalpoints.push_back(ImVec2{ point.x, point.y });
-		}
-	}
+	ProjectDrawCache(_cache, _cache.points, x, y);
 
-	if (_fill.r >= 0.0f)
+	if (_fill.r >= 0.0f && !_cache.indices.empty())
 	{
-		size_t i;
-		int y;
-		int miny, maxy;
-		int x1, y1;
-		int x2, y2;
-		int ind1, ind2;
-		size_t ints;
-		size_t n = finalpoints.size();
-		int* polyints = new int[n];
-
-		/* Determine Y maxima */
-		miny = (int)finalpoints[0].y;
-		maxy = (int)finalpoints[0].y;
-		for (i = 1; i < n; i++)
-		{
-			miny = std::min(miny, (int)finalpoints[i].y);
-			maxy = std::max(maxy, (int)finalpoints[i].y);
-		}
-
-		/* Draw, scanning y */
-		for (y = miny; y < maxy; y++) {
-			ints = 0;
-			for (i = 0; (i < n); i++) {
-				if (!i)
-				{
-					ind1 = (int)n - 1;
-					ind2 = 0;
-				}
-				else
-				{
-					ind1 = (int)i - 1;
-					ind2 = (int)i;
-				}
-				y1 = (int)finalpoints[ind1].y;
-				y2 = (int)finalpoints[ind2].y;
-				if (y1 < y2)
-				{
-					x1 = (int)finalpoints[ind1].x;
-					x2 = (int)finalpoints[ind2].x;
-				}
-				else if (y1 > y2)
-				{
-					y2 = (int)finalpoints[ind1].y;
-					y1 = (int)finalpoints[ind2].y;
-					x2 = (int)finalpoints[ind1].x;
-					x1 = (int)finalpoints[ind2].x;
-				}
-				else
-					continue;
-
-				if (((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)))
-					polyints[ints++] = (y - y1) * (x2 - x1) / (y2 - y1) + x1;
+		const ImU32 fill = _fill;
+		const ImVec2 uv = drawlist->_Data->TexUvWhitePixel;
 
-			}
-
-			auto compare_int = [](const void* a, const void* b)
-			{
-				return (*(const int*)a) - (*(const int*)b);
-			};
-
-			qsort(polyints, ints, sizeof(int), compare_int);
-
-			for (i = 0; i < ints; i += 2)
-			{
-				if (ImPlot::GetCurrentContext()->CurrentPlot)
-					drawlist->AddLine(ImPlot::PlotToPixels({ (float)polyints[i], (float)y }),
-						ImPlot::PlotToPixels({ (float)polyints[i + 1], (float)y }), _fill, ImPlot::GetCurrentContext()->Mx * _thickness);
-				else
-				{
-					drawlist->AddLine({ (float)polyints[i], (float)y },
-						{ (float)polyints[i + 1], (float)y }, _fill, _thickness);
-				}
-			}
-		}
-		delete[] polyints;
+		drawlist->PrimReserve((int)_cache.indices.size(), (int)_cache.screen.size());
+		const unsigned int base = drawlist->_VtxCurrentIdx;
+		for (const ImVec2& point : _cache.screen)
+			drawlist->PrimWriteVtx(point, uv, fill);
+		for (int index : _cache.indices)
+			drawlist->PrimWriteIdx((ImDrawIdx)(base + index));
 	}
-	// TODO: Find a way to store lines and only calc new fill lines when dirty similar to ellipse
-	drawlist->AddPolyline(finalpoints.data(), (int)finalpoints.size(), _color, false, _thickness);
+
+	drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color, false, _thickness);
 }
 
 void mvDrawPolygon::handleSpecificRequiredArgs(PyObject* dict)
@@ -1158,6 +1525,8 @@ void mvDrawPolygon::handleSpecificRequiredArgs(PyObject* dict)
 	_points = ToVectVec4(PyTuple_GetItem(dict, 0));
 	for (auto& point : _points)
 		point.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawPolygon::handleSpecificKeywordArgs(PyObject* dict)
@@ -1173,6 +1542,7 @@ void mvDrawPolygon::handleSpecificKeywordArgs(PyObject* dict)
 	for (auto& point : _points)
 		point.w = 1.0f;
 
+	_cache.dirty = true;
 }
 
 void mvDrawPolygon::getSpecificConfiguration(PyObject* dict)
@@ -1189,59 +1559,20 @@ void mvDrawPolygon::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawPolyline::draw(ImDrawList* drawlist, float x, float y)
 {
+	if (!IsDrawCacheValid(_cache, *drawInfo))
+		UpdateDrawCachePoints(_cache, _points.data(), _points.size());
 
-	mvVec4 start = { x, y };
-
-	std::vector<mvVec4> points = _points;
-	std::vector<ImVec2> finalpoints;
-	finalpoints.reserve(_points.size());
-
-	for (auto& point : points)
-		point = drawInfo->transform * point;
-
-	if (drawInfo->perspectiveDivide)
-	{
-
-		for (auto& point : points)
-		{
-			point.x = point.x / point.w;
-			point.x = point.x / point.w;
-			point.x = point.x / point.w;
-		}
-	}
+	if (_cache.clipped)
+		return;
 
-	if (drawInfo->depthClipping)
-	{
-		for (auto& point : points)
-			if (mvClipPoint(drawInfo->clipViewport, point)) return;
-	}
+	ProjectDrawCache(_cache, _cache.points, x, y);
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
-	{
-		for (auto& point : points)
-		{
-			ImVec2 impoint = ImPlot::PlotToPixels(point);
-			point.x = impoint.x;
-			point.y = impoint.y;
-			finalpoints.push_back(impoint);
-		}
-
-		drawlist->AddPolyline(finalpoints.data(), (int)finalpoints.size(), _color,
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color,
 			_closed, ImPlot::GetCurrentContext()->Mx * _thickness);
-	}
 	else
-	{
-		for (auto& point : points)
-		{
-			point = point + start;
-			finalpoints.push_back(ImVec2{ point.x, point.y });
-		}
-
-		drawlist->AddPolyline(finalpoints.data(), (int)finalpoints.size(), _color,
+		drawlist->AddPolyline(_cache.screen.data(), (int)_cache.screen.size(), _color,
 			_closed, _thickness);
-	}
-
-
 }
 
 void mvDrawPolyline::handleSpecificRequiredArgs(PyObject* dict)
@@ -1250,6 +1581,8 @@ void mvDrawPolyline::handleSpecificRequiredArgs(PyObject* dict)
 		return;
 
 	_points = ToVectVec4(PyTuple_GetItem(dict, 0));
+
+	_cache.dirty = true;
 }
 
 void mvDrawPolyline::handleSpecificKeywordArgs(PyObject* dict)
@@ -1264,6 +1597,8 @@ void mvDrawPolyline::handleSpecificKeywordArgs(PyObject* dict)
 
 	for (auto& point : _points)
 		point.w = 1.0f;
+
+	_cache.dirty = true;
 }
 
 void mvDrawPolyline::getSpecificConfiguration(PyObject* dict)
@@ -1280,36 +1615,13 @@ void mvDrawPolyline::getSpecificConfiguration(PyObject* dict)
 void mvDrawQuad::draw(ImDrawList* drawlist, float x, float y)
 {
 
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-	mvVec4  tp3 = drawInfo->transform * _p3;
-	mvVec4  tp4 = drawInfo->transform * _p4;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-		tp3.x = tp3.x / tp3.w;
-		tp4.x = tp4.x / tp4.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-		tp3.y = tp3.y / tp3.w;
-		tp4.y = tp4.y / tp4.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-		tp3.z = tp3.z / tp3.w;
-		tp4.z = tp4.z / tp4.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp3)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp4)) return;
-	}
+	mvVec4 points[] = { _p1, _p2, _p3, _p4 };
+	if (TransformDrawPoints(*drawInfo, points, 4))
+		return;
+	mvVec4& tp1 = points[0];
+	mvVec4& tp2 = points[1];
+	mvVec4& tp3 = points[2];
+	mvVec4& tp4 = points[3];
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 	{
@@ -1380,26 +1692,11 @@ void mvDrawQuad::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawRect::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tpmin = drawInfo->transform * _pmin;
-	mvVec4  tpmax = drawInfo->transform * _pmax;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tpmin.x = tpmin.x / tpmin.w;
-		tpmax.x = tpmax.x / tpmax.w;
-
-		tpmin.y = tpmin.y / tpmin.w;
-		tpmax.y = tpmax.y / tpmax.w;
-
-		tpmin.z = tpmin.z / tpmin.w;
-		tpmax.z = tpmax.z / tpmax.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tpmin)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tpmax)) return;
-	}
+	mvVec4 points[] = { _pmin, _pmax };
+	if (TransformDrawPoints(*drawInfo, points, 2))
+		return;
+	mvVec4& tpmin = points[0];
+	mvVec4& tpmax = points[1];
 
 	if (ImPlot::GetCurrentContext()->CurrentPlot)
 	{
@@ -1503,19 +1800,10 @@ void mvDrawRect::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawText::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tpos = drawInfo->transform * _pos;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tpos.x = tpos.x / tpos.w;
-		tpos.y = tpos.y / tpos.w;
-		tpos.z = tpos.z / tpos.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tpos)) return;
-	}
+	mvVec4 points[] = { _pos };
+	if (TransformDrawPoints(*drawInfo, points, 1))
+		return;
+	mvVec4& tpos = points[0];
 
 	ImFont* fontptr = ImGui::GetFont();
 	if (font)
@@ -1567,31 +1855,12 @@ void mvDrawText::getSpecificConfiguration(PyObject* dict)
 
 void mvDrawTriangle::draw(ImDrawList* drawlist, float x, float y)
 {
-	mvVec4  tp1 = drawInfo->transform * _p1;
-	mvVec4  tp2 = drawInfo->transform * _p2;
-	mvVec4  tp3 = drawInfo->transform * _p3;
-
-	if (drawInfo->perspectiveDivide)
-	{
-		tp1.x = tp1.x / tp1.w;
-		tp2.x = tp2.x / tp2.w;
-		tp3.x = tp3.x / tp3.w;
-
-		tp1.y = tp1.y / tp1.w;
-		tp2.y = tp2.y / tp2.w;
-		tp3.y = tp3.y / tp3.w;
-
-		tp1.z = tp1.z / tp1.w;
-		tp2.z = tp2.z / tp2.w;
-		tp3.z = tp3.z / tp3.w;
-	}
-
-	if (drawInfo->depthClipping)
-	{
-		if (mvClipPoint(drawInfo->clipViewport, tp1)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp2)) return;
-		if (mvClipPoint(drawInfo->clipViewport, tp3)) return;
-	}
+	mvVec4 points[] = { _p1, _p2, _p3 };
+	if (TransformDrawPoints(*drawInfo, points, 3))
+		return;
+	mvVec4& tp1 = points[0];
+	mvVec4& tp2 = points[1];
+	mvVec4& tp3 = points[2];
 
 	if (drawInfo->cullMode == 1) // backface
 	{
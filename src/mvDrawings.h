@@ -2,6 +2,25 @@
 
 #include "mvItemRegistry.h"
 
+//-----------------------------------------------------------------------------
+// mvDrawCache
+//     * transformed space geometry kept between frames
+//     * rebuilt only when the item's points or draw info change
+//     * screen space mapping (plot or drawlist offset) is redone per frame
+//       into the reused "screen" buffer
+//-----------------------------------------------------------------------------
+struct mvDrawCache
+{
+    mvAppItemDrawInfo   info;
+    std::vector<ImVec2> points;      // transformed points (or curve control points)
+    std::vector<ImVec2> curve;       // tessellated curve (beziers only)
+    std::vector<ImVec2> screen;
+    std::vector<int>    indices;     // fill triangulation (polygons only)
+    int                 segments = 0;
+    bool                clipped = false;
+    bool                dirty = true;
+};
+
 class mvViewportDrawlist : public mvAppItem
 {
 
@@ -91,6 +110,73 @@ private:
 
 };
 
+enum class mvDrawBatchKind
+{
+    Lines = 0, Circles = 1, Rects = 2, Triangles = 3, Points = 4
+};
+
+//-----------------------------------------------------------------------------
+// mvDrawBatchColumn
+//     * one column of a draw batch (p1, center, radius, color, ...)
+//     * rows are "width" components wide
+//     * buffers matching the column layout are held instead of copied
+//-----------------------------------------------------------------------------
+template<typename T>
+struct mvDrawBatchColumn
+{
+    mvDrawBatchColumn() = default;
+    mvDrawBatchColumn(const mvDrawBatchColumn&) = delete; // view must only be released once
+    mvDrawBatchColumn& operator=(const mvDrawBatchColumn&) = delete;
+
+    Py_buffer      view = {};
+    bool           viewHeld = false;
+    std::vector<T> owned;
+    T*             data = nullptr;
+    int            width = 1;
+    size_t         rows = 0;
+};
+
+class mvDrawBatch : public mvAppItem
+{
+
+public:
+
+    explicit mvDrawBatch(mvUUID uuid) : mvAppItem(uuid) { _p1.width = _p2.width = _p3.width = 2; }
+    ~mvDrawBatch();
+
+    void draw(ImDrawList* drawlist, float x, float y) override;
+    void handleSpecificKeywordArgs(PyObject* dict) override;
+    void getSpecificConfiguration(PyObject* dict) override;
+
+    // writes rows [start, start + n) of the supplied columns
+    void updateRange(size_t start, PyObject* dict);
+
+private:
+
+    size_t primitiveCount() const;
+
+private:
+
+    mvDrawBatchKind           _kind = mvDrawBatchKind::Lines;
+    mvDrawBatchColumn<float>  _p1;
+    mvDrawBatchColumn<float>  _p2;
+    mvDrawBatchColumn<float>  _p3;
+    mvDrawBatchColumn<float>  _radii;
+    mvDrawBatchColumn<float>  _thicknesses;
+    mvDrawBatchColumn<ImU32>  _colors;
+    mvColor                   _color = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float                     _radius = 1.0f;
+    float                     _thickness = 1.0f;
+    int                       _segments = 0;
+    int                       _count = -1;
+    bool                      _fill = false;
+
+    // per frame projection of p1/p2/p3 (reused between frames)
+    std::vector<ImVec2>       _screen[3];
+    std::vector<u8>           _clipped[3];
+
+};
+
 class mvDrawBezierCubic : public mvAppItem
 {
 
@@ -113,6 +199,7 @@ private:
     mvColor _color;
     float   _thickness = 0.0f;
     int     _segments = 0;
+    mvDrawCache _cache;
 
 };
 
@@ -137,6 +224,7 @@ private:
     mvColor _color;
     float   _thickness = 0.0f;
     int     _segments = 0;
+    mvDrawCache _cache;
 
 };
 
@@ -292,6 +380,7 @@ private:
     mvColor             _color;
     mvColor             _fill;
     float               _thickness = 1.0f;
+    mvDrawCache         _cache;
 
 };
 
@@ -314,6 +403,7 @@ private:
     mvColor             _color;
     bool                _closed = false;
     float               _thickness = 1.0f;
+    mvDrawCache         _cache;
 
 };
 
@@ -151,7 +151,7 @@ void mvFileDialog::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
-	_value = *static_cast<std::shared_ptr<bool>*>(item->getValue());
+	_value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(item->getValue());
 }
 
 void mvFileDialog::handleSpecificKeywordArgs(PyObject* dict)
@@ -34,7 +34,7 @@ public:
 
 public:
 
-    std::shared_ptr<bool>     _value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> _value = std::make_shared<std::atomic<bool>>(false);
     bool             _disabled_value = false;
     ImGuiFileDialog  _instance;
     bool             _dirtySettings = true;
@@ -45,6 +45,8 @@ void mvCharRemap::handleSpecificRequiredArgs(PyObject* dict)
 
 void mvFont::customAction(void* data)
 {
+	_fontPtr = nullptr;
+
 	if (!state.ok)
 		return;
 
@@ -58,18 +60,20 @@ void mvFont::customAction(void* data)
 	if (_fontPtr == nullptr)
 	{
 		mvThrowPythonError(mvErrorCode::mvNone, "Font file could not be found");
-		io.Fonts->Build();
 		return;
 	}
 
-	// handled by char remaps
-	//for (auto& item : font.charRemaps)
-	//	_fontPtr->AddRemapChar(item.first, item.second);
-
-	io.Fonts->Build();
+	// the atlas is built (or loaded from the cache) once all
+	// fonts are added, see mvFontManager::rebuildAtlas()
 
 	if (_default)
 		io.FontDefault = _fontPtr;
+}
+
+void mvFont::applyCharRemaps()
+{
+	if (_fontPtr == nullptr)
+		return;
 
 	// check ranges
 	for (const auto& range : childslots[1])
@@ -91,7 +95,13 @@ void mvFont::draw(ImDrawList* drawlist, float x, float y)
 	if (!state.ok)
 		return;
 
+	buildRanges();
+}
+
+void mvFont::buildRanges()
+{
 	ImFontGlyphRangesBuilder builder;
+	ImFontGlyphRangesBuilder dynamicBuilder;
 
 	static ImFontAtlas atlas;
 
@@ -132,13 +142,14 @@ void mvFont::draw(ImDrawList* drawlist, float x, float y)
 
 	}
 
-	// check ranges and chars
+	// check ranges and chars (only rasterized on demand for dynamic fonts)
+	ImFontGlyphRangesBuilder& rangesBuilder = _dynamic ? dynamicBuilder : builder;
 	for (const auto& range : childslots[1])
 	{
 		if (range->type == mvAppItemType::mvFontRange)
 		{
 			const auto rangePtr = static_cast<const mvFontRange*>(range.get());
-			builder.AddRanges(rangePtr->getRange().data());
+			rangesBuilder.AddRanges(rangePtr->getRange().data());
 		}
 
 		else if (range->type == mvAppItemType::mvFontChars)
@@ -146,10 +157,19 @@ void mvFont::draw(ImDrawList* drawlist, float x, float y)
 			const auto rangePtr = static_cast<const mvFontChars*>(range.get());
 
 			for (const auto& specificChar : rangePtr->getCharacters())
-				builder.AddChar(specificChar);
+				rangesBuilder.AddChar(specificChar);
 		}
 	}
 
+	if (_dynamic)
+	{
+		for (ImWchar c : _dynamicGlyphs.added)
+			builder.AddChar(c);
+		_dynamicGlyphs.ranges.clear();
+		dynamicBuilder.BuildRanges(&_dynamicGlyphs.ranges);
+	}
+
+	_ranges.clear();
 	builder.BuildRanges(&_ranges);   // Build the final result (ordered ranges with all the unique characters submitted)
 
 	//_dirty = true;
@@ -186,6 +206,12 @@ void mvFont::handleSpecificKeywordArgs(PyObject* dict)
 		return;
 
     if (PyObject* item = PyDict_GetItemString(dict, "pixel_snapH")) _pixel_snap_h = ToBool(item);
+    if (PyObject* item = PyDict_GetItemString(dict, "dynamic"))
+    {
+        _dynamic = ToBool(item);
+        if (_dynamic)
+            mvEnableDynamicGlyphs();
+    }
 }
 
 void mvFont::getSpecificConfiguration(PyObject* dict)
@@ -196,6 +222,7 @@ void mvFont::getSpecificConfiguration(PyObject* dict)
 	PyDict_SetItemString(dict, "file", ToPyString(_file));
 	PyDict_SetItemString(dict, "size", ToPyFloat(_size));
 	PyDict_SetItemString(dict, "pixel_snapH", ToPyBool(_pixel_snap_h));
+	PyDict_SetItemString(dict, "dynamic", ToPyBool(_dynamic));
 }
 
 void mvFontChars::handleSpecificRequiredArgs(PyObject* dict)
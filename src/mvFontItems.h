@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <future>
+#include <unordered_set>
 #include "mvItemRegistry.h"
 
 class mvFontRegistry : public mvAppItem
@@ -41,6 +43,37 @@ private:
 
 };
 
+// glyph rasterized off the render thread for dynamic fonts
+struct mvRasterizedGlyph
+{
+    ImWchar                    codepoint = 0;
+    int                        width = 0;
+    int                        height = 0;
+    float                      x0 = 0.0f;
+    float                      y0 = 0.0f; // relative to the baseline
+    float                      x1 = 0.0f; // bitmap size / oversampling
+    float                      y1 = 0.0f;
+    float                      advance = 0.0f;
+    std::vector<unsigned char> pixels;
+};
+
+// state of a font in dynamic glyph mode. Only the base ranges are built
+// into the atlas, ranges & chars children are rasterized on demand into
+// a region of the atlas reserved at build time (see mvFontManager).
+struct mvDynamicGlyphs
+{
+    ImVector<ImWchar>                             ranges;    // codepoints that may be added on demand
+    std::vector<ImWchar>                          added;     // codepoints added so far (built statically on rebuild)
+    std::unordered_set<ImWchar>                   requested; // never requested twice
+    std::vector<ImWchar>                          backlog;   // waiting for the running job
+    std::future<std::vector<mvRasterizedGlyph>>   job;
+    std::shared_ptr<std::vector<unsigned char>>   fileData;
+    int                                           rectId = -1;
+    int                                           cursorX = 0;
+    int                                           cursorY = 0;
+    int                                           rowHeight = 0;
+};
+
 class mvFont : public mvAppItem
 {
 
@@ -50,10 +83,12 @@ public:
 
     void draw(ImDrawList* drawlist, float x, float y) override;
     void customAction(void* data = nullptr) override;
+    void applyCharRemaps(); // requires the atlas to be built
     void handleSpecificRequiredArgs(PyObject* dict) override;
     void handleSpecificKeywordArgs(PyObject* dict) override;
     void getSpecificConfiguration(PyObject* dict) override;
     ImFont* getFontPtr() { return _fontPtr; }
+    void buildRanges();
 
 public:
 
@@ -62,10 +97,12 @@ public:
     float       _size = 13.0f;
     bool        _default = false;
     bool        _pixel_snap_h = false;
+    bool        _dynamic = false;
 
     // finalized
     ImFont* _fontPtr = nullptr;
     ImVector<ImWchar> _ranges;
+    mvDynamicGlyphs _dynamicGlyphs;
 
 };
 
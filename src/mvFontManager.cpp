@@ -11,9 +11,25 @@
 #include "mvPyUtils.h"
 #include <frameobject.h>
 #include "mvTextureItems.h"
+#include "mvFontItems.h"
+#include "mvUtilities.h"
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <mutex>
+#include <atomic>
+#include <cmath>
+#include <climits>
+#include <algorithm>
 #include <CustomFont.cpp>
 #include <CustomFont.h>
 
+// private copy of stb_truetype used for dynamic glyphs
+// (imgui's copy is static to imgui_draw.cpp)
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imstb_truetype.h>
+
 #define IM_MIN(A, B)            (((A) < (B)) ? (A) : (B))
 #define IM_MAX(A, B)            (((A) >= (B)) ? (A) : (B))
 
@@ -145,6 +161,588 @@ if (ImGui::BeginCombo(label, font_current->GetDebugName()))
 }
 }
 
+//-----------------------------------------------------------------------------
+// font atlas cache
+//   The packed atlas (pixels, custom rects & glyph metrics) is stored on disk
+//   keyed by everything that affects the build. Loading it skips rasterizing
+//   which takes seconds for large (i.e. CJK) ranges at several sizes.
+//-----------------------------------------------------------------------------
+
+// atlas room reserved per dynamic font, in glyphs (clamped to the ranges)
+static const int MV_DYNAMIC_GLYPH_BUDGET = 1024;
+static const int MV_DYNAMIC_GLYPH_REGION_MAX = 4096;
+
+static const u32 MV_ATLAS_CACHE_MAGIC = 0x41475044; // "DPGA"
+static const u32 MV_ATLAS_CACHE_VERSION = 1;
+
+// TexReady only exists in newer imgui versions
+template<typename T> static auto
+SetAtlasTexReady(T& atlas, int) -> decltype(atlas.TexReady = true, void()) { atlas.TexReady = true; }
+template<typename T> static void
+SetAtlasTexReady(T& atlas, long) {}
+
+static void
+HashBytes(unsigned long long& hash, const void* data, size_t size)
+{
+	// FNV-1a
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+}
+
+template<typename T> static void
+HashValue(unsigned long long& hash, const T& value) { HashBytes(hash, &value, sizeof(T)); }
+
+static unsigned long long
+GetAtlasCacheKey(const std::vector<std::shared_ptr<mvAppItem>>& fonts, float globalScale)
+{
+	ImFontAtlas& atlas = *ImGui::GetIO().Fonts;
+
+	unsigned long long hash = 14695981039346656037ULL;
+	HashValue(hash, MV_ATLAS_CACHE_VERSION);
+	HashBytes(hash, IMGUI_VERSION, strlen(IMGUI_VERSION));
+	HashValue(hash, sizeof(ImWchar));
+	HashValue(hash, sizeof(ImFontGlyph));
+	HashValue(hash, sizeof(ImFontAtlasCustomRect));
+	HashValue(hash, atlas.Flags);
+	HashValue(hash, atlas.TexDesiredWidth);
+	HashValue(hash, atlas.TexGlyphPadding);
+	HashValue(hash, globalScale);
+
+	// the cache replaces the custom rects, they have to match the ones reserved
+	for (const auto& rect : atlas.CustomRects)
+	{
+		HashValue(hash, rect.Width);
+		HashValue(hash, rect.Height);
+		HashValue(hash, rect.GlyphID);
+		HashValue(hash, atlas.Fonts.index_from_ptr(atlas.Fonts.find(rect.Font)));
+	}
+#ifdef IMGUI_ENABLE_FREETYPE
+	HashValue(hash, 1);
+#endif
+
+	for (const auto& item : fonts)
+	{
+		const mvFont* font = static_cast<const mvFont*>(item.get());
+		if (!font->state.ok)
+			continue;
+
+		HashBytes(hash, font->_file.data(), font->_file.size());
+		HashValue(hash, font->_size);
+		HashValue(hash, font->_pixel_snap_h);
+		HashBytes(hash, font->_ranges.Data, font->_ranges.size_in_bytes());
+		HashValue(hash, font->_dynamic);
+		if (font->_dynamic)
+			HashBytes(hash, font->_dynamicGlyphs.ranges.Data, font->_dynamicGlyphs.ranges.size_in_bytes());
+
+		for (const auto& child : font->childslots[1])
+		{
+			if (child->type != mvAppItemType::mvCharRemap)
+				continue;
+			const mvCharRemap* remap = static_cast<const mvCharRemap*>(child.get());
+			HashValue(hash, remap->getSourceChar());
+			HashValue(hash, remap->getTargetChar());
+		}
+
+		// file contents, so edited fonts are picked up
+		std::ifstream file(font->_file, std::ios::binary);
+		char buffer[1 << 16];
+		while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+			HashBytes(hash, buffer, (size_t)file.gcount());
+	}
+
+	return hash;
+}
+
+static void
+SaveAtlasCache(ImFontAtlas& atlas, const std::string& path)
+{
+	bool rgba = atlas.TexPixelsAlpha8 == nullptr;
+	const void* pixels = rgba ? (const void*)atlas.TexPixelsRGBA32 : (const void*)atlas.TexPixelsAlpha8;
+	if (pixels == nullptr)
+		return;
+
+	// written to a temporary file first, so a crash never leaves a partial cache
+	std::string tempPath = path + ".tmp";
+	std::ofstream file(tempPath, std::ios::binary);
+	if (!file)
+		return;
+
+	auto write = [&file](const void* data, size_t size) { file.write(static_cast<const char*>(data), size); };
+	auto writeValue = [&write](const auto& value) { write(&value, sizeof(value)); };
+
+	writeValue(MV_ATLAS_CACHE_MAGIC);
+	writeValue(MV_ATLAS_CACHE_VERSION);
+	writeValue(atlas.TexWidth);
+	writeValue(atlas.TexHeight);
+	writeValue(rgba);
+	write(pixels, (size_t)atlas.TexWidth * atlas.TexHeight * (rgba ? 4 : 1));
+	writeValue(atlas.TexUvScale);
+	writeValue(atlas.TexUvWhitePixel);
+	write(atlas.TexUvLines, sizeof(atlas.TexUvLines));
+	writeValue(atlas.PackIdMouseCursors);
+	writeValue(atlas.PackIdLines);
+
+	writeValue(atlas.CustomRects.Size);
+	for (const auto& rect : atlas.CustomRects)
+	{
+		int fontIndex = rect.Font ? atlas.Fonts.index_from_ptr(atlas.Fonts.find(rect.Font)) : -1;
+		writeValue(rect);
+		writeValue(fontIndex);
+	}
+
+	writeValue(atlas.Fonts.Size);
+	for (const ImFont* font : atlas.Fonts)
+	{
+		writeValue(font->FontSize);
+		writeValue(font->Ascent);
+		writeValue(font->Descent);
+		writeValue(font->FallbackChar);
+		writeValue(font->EllipsisChar);
+		writeValue(font->MetricsTotalSurface);
+		writeValue(font->Glyphs.Size);
+		write(font->Glyphs.Data, font->Glyphs.size_in_bytes());
+	}
+
+	file.close();
+	if (!file)
+	{
+		remove(tempPath.c_str());
+		return;
+	}
+
+	remove(path.c_str());
+	rename(tempPath.c_str(), path.c_str());
+}
+
+static bool
+LoadAtlasCache(ImFontAtlas& atlas, const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+
+	auto read = [&file](void* data, size_t size) { return (bool)file.read(static_cast<char*>(data), size); };
+	auto readValue = [&read](auto& value) { return read(&value, sizeof(value)); };
+
+	u32 magic = 0;
+	u32 version = 0;
+	int width = 0;
+	int height = 0;
+	bool rgba = false;
+	if (!readValue(magic) || !readValue(version) || magic != MV_ATLAS_CACHE_MAGIC || version != MV_ATLAS_CACHE_VERSION)
+		return false;
+	if (!readValue(width) || !readValue(height) || !readValue(rgba) || width <= 0 || height <= 0)
+		return false;
+
+	// everything is read into temporaries and only applied once the file
+	// proved complete, otherwise the atlas is built normally
+	size_t pixelBytes = (size_t)width * height * (rgba ? 4 : 1);
+	unsigned char* pixels = (unsigned char*)IM_ALLOC(pixelBytes);
+	ImVec2 uvScale, uvWhitePixel;
+	ImVec4 uvLines[IM_ARRAYSIZE(atlas.TexUvLines)];
+	int packIdMouseCursors = -1;
+	int packIdLines = -1;
+	int rectCount = 0;
+	bool ok = read(pixels, pixelBytes) && readValue(uvScale) && readValue(uvWhitePixel) && read(uvLines, sizeof(uvLines))
+		&& readValue(packIdMouseCursors) && readValue(packIdLines) && readValue(rectCount) && rectCount >= 0;
+
+	ImVector<ImFontAtlasCustomRect> rects;
+	ImVector<int> rectFonts;
+	if (ok)
+	{
+		rects.resize(rectCount);
+		rectFonts.resize(rectCount);
+		for (int i = 0; i < rectCount && ok; i++)
+			ok = readValue(rects[i]) && readValue(rectFonts[i]);
+	}
+
+	struct FontData
+	{
+		float FontSize, Ascent, Descent;
+		ImWchar FallbackChar, EllipsisChar;
+		int MetricsTotalSurface;
+		ImVector<ImFontGlyph> Glyphs;
+	};
+
+	int fontCount = 0;
+	ok = ok && readValue(fontCount) && fontCount == atlas.Fonts.Size;
+	std::vector<FontData> fonts(ok ? fontCount : 0);
+	for (auto& font : fonts)
+	{
+		int glyphCount = 0;
+		ok = readValue(font.FontSize) && readValue(font.Ascent) && readValue(font.Descent) && readValue(font.FallbackChar)
+			&& readValue(font.EllipsisChar) && readValue(font.MetricsTotalSurface) && readValue(glyphCount) && glyphCount >= 0;
+		if (!ok)
+			break;
+		font.Glyphs.resize(glyphCount);
+		ok = read(font.Glyphs.Data, font.Glyphs.size_in_bytes());
+		if (!ok)
+			break;
+	}
+
+	if (!ok)
+	{
+		IM_FREE(pixels);
+		return false;
+	}
+
+	// same as ImFontAtlas::Build(), minus the rasterizing
+	atlas.ClearTexData();
+	atlas.TexWidth = width;
+	atlas.TexHeight = height;
+	if (rgba)
+		atlas.TexPixelsRGBA32 = (unsigned int*)pixels;
+	else
+		atlas.TexPixelsAlpha8 = pixels;
+	atlas.TexUvScale = uvScale;
+	atlas.TexUvWhitePixel = uvWhitePixel;
+	memcpy(atlas.TexUvLines, uvLines, sizeof(uvLines));
+	atlas.PackIdMouseCursors = packIdMouseCursors;
+	atlas.PackIdLines = packIdLines;
+	atlas.CustomRects.swap(rects);
+	for (int i = 0; i < atlas.CustomRects.Size; i++)
+		atlas.CustomRects[i].Font = rectFonts[i] >= 0 && rectFonts[i] < atlas.Fonts.Size ? atlas.Fonts[rectFonts[i]] : nullptr;
+
+	for (int i = 0; i < atlas.Fonts.Size; i++)
+	{
+		ImFont* font = atlas.Fonts[i];
+		font->ClearOutputData();
+		font->ContainerAtlas = &atlas;
+		font->ConfigData = nullptr;
+		font->ConfigDataCount = 0;
+		for (ImFontConfig& cfg : atlas.ConfigData)
+		{
+			if (cfg.DstFont != font)
+				continue;
+			if (font->ConfigData == nullptr)
+				font->ConfigData = &cfg;
+			font->ConfigDataCount++;
+		}
+
+		font->FontSize = fonts[i].FontSize;
+		font->Ascent = fonts[i].Ascent;
+		font->Descent = fonts[i].Descent;
+		font->FallbackChar = fonts[i].FallbackChar;
+		font->EllipsisChar = fonts[i].EllipsisChar;
+		font->MetricsTotalSurface = fonts[i].MetricsTotalSurface;
+		font->Glyphs.swap(fonts[i].Glyphs);
+		font->BuildLookupTable();
+	}
+
+	SetAtlasTexReady(atlas, 0);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// dynamic glyphs
+//   Codepoints are recorded from any thread, rasterized with stb_truetype on
+//   a worker and committed between frames into the atlas region reserved for
+//   each dynamic font. Only the touched rows of the font texture are uploaded.
+//-----------------------------------------------------------------------------
+
+static std::atomic_bool        GDynamicGlyphs = false;
+static std::mutex              GRequestedGlyphsMutex;
+static std::vector<ImWchar>    GRequestedGlyphs;
+static std::vector<u32>        GRequestedGlyphsPending; // bitset, a codepoint is queued at most once
+
+// which codepoints are queued is tracked, so the queue never holds more
+// than one entry per codepoint and no request has to be dropped
+static bool
+MarkGlyphPending(unsigned int codepoint)
+{
+	if (GRequestedGlyphsPending.empty())
+		GRequestedGlyphsPending.resize(IM_UNICODE_CODEPOINT_MAX / 32 + 1, 0u);
+	u32& bits = GRequestedGlyphsPending[codepoint / 32];
+	const u32 mask = 1u << (codepoint % 32);
+	if (bits & mask)
+		return false;
+	bits |= mask;
+	return true;
+}
+
+void
+mvEnableDynamicGlyphs()
+{
+	GDynamicGlyphs = true;
+}
+
+void
+mvRequestGlyphs(const char* text, size_t size)
+{
+	if (!GDynamicGlyphs)
+		return;
+
+	const unsigned char* c = reinterpret_cast<const unsigned char*>(text);
+	const unsigned char* end = c + size;
+	std::unique_lock<std::mutex> lk(GRequestedGlyphsMutex, std::defer_lock);
+	while (c < end)
+	{
+		if (*c < 0x80)
+		{
+			c++;
+			continue;
+		}
+
+		// utf-8 decode (invalid sequences are skipped)
+		unsigned int codepoint = 0;
+		int length = (*c & 0xE0) == 0xC0 ? 2 : (*c & 0xF0) == 0xE0 ? 3 : (*c & 0xF8) == 0xF0 ? 4 : 1;
+		if (length == 1 || c + length > end)
+		{
+			c++;
+			continue;
+		}
+		codepoint = *c & (0xFF >> (length + 1));
+		for (int i = 1; i < length; i++)
+			codepoint = (codepoint << 6) | (c[i] & 0x3F);
+		c += length;
+
+		if (codepoint > IM_UNICODE_CODEPOINT_MAX)
+			continue;
+
+		if (!lk.owns_lock())
+			lk.lock();
+		if (MarkGlyphPending(codepoint))
+			GRequestedGlyphs.push_back((ImWchar)codepoint);
+	}
+}
+
+static bool
+IsInGlyphRanges(const ImVector<ImWchar>& ranges, ImWchar codepoint)
+{
+	for (int i = 0; i + 1 < ranges.Size && ranges[i] != 0; i += 2)
+	{
+		if (codepoint >= ranges[i] && codepoint <= ranges[i + 1])
+			return true;
+	}
+	return false;
+}
+
+// oversampling matches the stb_truetype atlas builder. Freetype builds
+// don't oversample, glyphs added there are unhinted stb_truetype output.
+static std::vector<mvRasterizedGlyph>
+RasterizeGlyphs(std::shared_ptr<std::vector<unsigned char>> fileData, float size, int oversampleH, int oversampleV, std::vector<ImWchar> codepoints)
+{
+	std::vector<mvRasterizedGlyph> glyphs;
+
+	const unsigned char* data = fileData->data();
+	stbtt_fontinfo info;
+	if (!stbtt_InitFont(&info, data, stbtt_GetFontOffsetForIndex(data, 0)))
+		return glyphs;
+
+	// same scale as the atlas builder
+	float scale = stbtt_ScaleForPixelHeight(&info, size);
+	for (ImWchar codepoint : codepoints)
+	{
+		int index = stbtt_FindGlyphIndex(&info, codepoint);
+		if (index == 0)
+			continue; // not in this font
+
+		mvRasterizedGlyph glyph;
+		glyph.codepoint = codepoint;
+
+		int advance, leftSideBearing;
+		stbtt_GetGlyphHMetrics(&info, index, &advance, &leftSideBearing);
+		glyph.advance = advance * scale;
+
+		int x0, y0, x1, y1;
+		stbtt_GetGlyphBitmapBoxSubpixel(&info, index, scale * oversampleH, scale * oversampleV, 0.0f, 0.0f, &x0, &y0, &x1, &y1);
+		if (x1 > x0 && y1 > y0)
+		{
+			glyph.width = x1 - x0 + oversampleH - 1;
+			glyph.height = y1 - y0 + oversampleV - 1;
+		}
+		glyph.pixels.resize((size_t)glyph.width * glyph.height);
+
+		float subX = 0.0f;
+		float subY = 0.0f;
+		if (glyph.width > 0 && glyph.height > 0)
+			stbtt_MakeGlyphBitmapSubpixelPrefilter(&info, glyph.pixels.data(), glyph.width, glyph.height, glyph.width,
+				scale * oversampleH, scale * oversampleV, 0.0f, 0.0f, oversampleH, oversampleV, &subX, &subY, index);
+
+		glyph.x0 = x0 / (float)oversampleH + subX;
+		glyph.y0 = y0 / (float)oversampleV + subY;
+		glyph.x1 = glyph.x0 + glyph.width / (float)oversampleH;
+		glyph.y1 = glyph.y0 + glyph.height / (float)oversampleV;
+
+		glyphs.push_back(std::move(glyph));
+	}
+
+	return glyphs;
+}
+
+// copies finished glyphs into the font's atlas region. Returns false if the
+// region is full, the remaining glyphs are then built statically on rebuild.
+static bool
+CommitDynamicGlyphs(mvFont& font, std::vector<mvRasterizedGlyph>& glyphs)
+{
+	ImFontAtlas& atlas = *ImGui::GetIO().Fonts;
+	mvDynamicGlyphs& dynamic = font._dynamicGlyphs;
+	ImFont* imfont = font.getFontPtr();
+	const ImFontAtlasCustomRect* region = atlas.GetCustomRectByIndex(dynamic.rectId);
+	const ImFontConfig* cfg = imfont->ConfigData;
+	const float offsetY = (cfg ? cfg->GlyphOffset.y : 0.0f) + floorf(imfont->Ascent + 0.5f);
+	const float offsetX = cfg ? cfg->GlyphOffset.x : 0.0f;
+
+	int minY = INT_MAX;
+	int maxY = INT_MIN;
+	bool full = false;
+	for (const auto& glyph : glyphs)
+	{
+		if (imfont->FindGlyphNoFallback(glyph.codepoint))
+			continue;
+
+		dynamic.added.push_back(glyph.codepoint);
+		if (full)
+			continue;
+
+		// shelf packing with 1px padding
+		if (dynamic.cursorX + glyph.width + 1 > region->Width)
+		{
+			dynamic.cursorX = 0;
+			dynamic.cursorY += dynamic.rowHeight + 1;
+			dynamic.rowHeight = 0;
+		}
+		if (glyph.width + 1 > region->Width || dynamic.cursorY + glyph.height + 1 > region->Height)
+		{
+			full = true;
+			continue;
+		}
+
+		int x = region->X + dynamic.cursorX;
+		int y = region->Y + dynamic.cursorY;
+		for (int row = 0; row < glyph.height; row++)
+		{
+			const unsigned char* src = glyph.pixels.data() + (size_t)row * glyph.width;
+			size_t offset = (size_t)(y + row) * atlas.TexWidth + x;
+			if (atlas.TexPixelsAlpha8)
+				memcpy(atlas.TexPixelsAlpha8 + offset, src, glyph.width);
+			if (atlas.TexPixelsRGBA32)
+			{
+				for (int column = 0; column < glyph.width; column++)
+					atlas.TexPixelsRGBA32[offset + column] = IM_COL32(255, 255, 255, src[column]);
+			}
+		}
+
+		// AddGlyph applies the advance clamping, PixelSnapH and
+		// GlyphExtraSpacing of cfg, the same as the atlas builder
+		imfont->AddGlyph(cfg, glyph.codepoint,
+			glyph.x0 + offsetX, glyph.y0 + offsetY, glyph.x1 + offsetX, glyph.y1 + offsetY,
+			x * atlas.TexUvScale.x, y * atlas.TexUvScale.y, (x + glyph.width) * atlas.TexUvScale.x, (y + glyph.height) * atlas.TexUvScale.y,
+			glyph.advance);
+
+		dynamic.cursorX += glyph.width + 1;
+		dynamic.rowHeight = std::max(dynamic.rowHeight, glyph.height);
+		minY = std::min(minY, y);
+		maxY = std::max(maxY, y + glyph.height);
+	}
+
+	if (minY < maxY)
+	{
+		imfont->BuildLookupTable();
+		font.applyCharRemaps();
+
+		// upload the touched rows of the region
+		if (atlas.TexID)
+		{
+			std::vector<unsigned char> rgba((size_t)region->Width * (maxY - minY) * 4);
+			for (int y = minY; y < maxY; y++)
+			{
+				for (int x = 0; x < region->Width; x++)
+				{
+					size_t offset = (size_t)y * atlas.TexWidth + region->X + x;
+					unsigned char* dst = &rgba[((size_t)(y - minY) * region->Width + x) * 4];
+					dst[0] = dst[1] = dst[2] = 255;
+					dst[3] = atlas.TexPixelsAlpha8 ? atlas.TexPixelsAlpha8[offset] : (unsigned char)(atlas.TexPixelsRGBA32[offset] >> IM_COL32_A_SHIFT);
+				}
+			}
+			UpdateTextureRegion(atlas.TexID, region->X, minY, region->Width, maxY - minY, rgba.data());
+		}
+	}
+
+	return !full;
+}
+
+void
+mvFontManager::updateDynamicGlyphs()
+{
+	if (!GDynamicGlyphs || _dirty)
+		return;
+
+	// taken every frame, so requests don't pile up while there are no fonts
+	std::vector<ImWchar> requested;
+	{
+		std::lock_guard<std::mutex> lk(GRequestedGlyphsMutex);
+		requested.swap(GRequestedGlyphs);
+		for (ImWchar c : requested)
+			GRequestedGlyphsPending[c / 32] &= ~(1u << (c % 32));
+	}
+
+	auto& roots = GContext->itemRegistry->fontRegistryRoots;
+	ImFontAtlas& atlas = *ImGui::GetIO().Fonts;
+	if (roots.empty() || (atlas.TexPixelsAlpha8 == nullptr && atlas.TexPixelsRGBA32 == nullptr))
+		return;
+
+	// typed characters never pass through dpg strings
+	for (ImWchar c : ImGui::GetIO().InputQueueCharacters)
+	{
+		if (c >= 0x80)
+			requested.push_back(c);
+	}
+
+	for (auto& item : roots[0]->childslots[1])
+	{
+		mvFont* font = static_cast<mvFont*>(item.get());
+		mvDynamicGlyphs& dynamic = font->_dynamicGlyphs;
+		if (!font->_dynamic || font->getFontPtr() == nullptr || dynamic.rectId < 0)
+			continue;
+
+		for (ImWchar c : requested)
+		{
+			if (!IsInGlyphRanges(dynamic.ranges, c) || !dynamic.requested.insert(c).second)
+				continue;
+			dynamic.backlog.push_back(c);
+		}
+
+		// commit a finished job
+		if (dynamic.job.valid() && dynamic.job.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		{
+			std::vector<mvRasterizedGlyph> glyphs = dynamic.job.get();
+			if (!CommitDynamicGlyphs(*font, glyphs))
+			{
+				// region is full, build everything added so far statically
+				font->buildRanges();
+				continue;
+			}
+		}
+
+		// start the next one
+		if (!dynamic.job.valid() && !dynamic.backlog.empty())
+		{
+			if (!dynamic.fileData)
+			{
+				std::ifstream file(font->_file, std::ios::binary);
+				dynamic.fileData = std::make_shared<std::vector<unsigned char>>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			}
+
+			std::vector<ImWchar> codepoints;
+			codepoints.swap(dynamic.backlog);
+			const ImFontConfig* cfg = font->getFontPtr()->ConfigData;
+#ifdef IMGUI_ENABLE_FREETYPE
+			int oversampleH = 1;
+			int oversampleV = 1;
+#else
+			int oversampleH = cfg ? std::max(cfg->OversampleH, 1) : 1;
+			int oversampleV = cfg ? std::max(cfg->OversampleV, 1) : 1;
+#endif
+			dynamic.job = std::async(std::launch::async, RasterizeGlyphs, dynamic.fileData, font->_size, oversampleH, oversampleV, std::move(codepoints));
+		}
+	}
+}
+
 bool 
 mvFontManager::isInvalid() const
 {
@@ -165,6 +763,47 @@ mvFontManager::rebuildAtlas()
 		for (auto& item : roots[0]->childslots[1])
 		{
 			item->customAction(nullptr);
+
+			// reserve the atlas region dynamic glyphs are added to
+			mvFont* font = static_cast<mvFont*>(item.get());
+			mvDynamicGlyphs& dynamic = font->_dynamicGlyphs;
+			dynamic.rectId = -1;
+			if (font->_dynamic && font->getFontPtr())
+			{
+				// room for the ranges (up to the budget) at the font's cell size
+				int count = 0;
+				for (int i = 0; i + 1 < dynamic.ranges.Size && dynamic.ranges[i] != 0; i += 2)
+					count += dynamic.ranges[i + 1] - dynamic.ranges[i] + 1;
+				count = std::min(count, MV_DYNAMIC_GLYPH_BUDGET);
+				const ImFontConfig* cfg = font->getFontPtr()->ConfigData;
+				float cellWidth = font->_size * (cfg ? cfg->OversampleH : 1) + 2.0f;
+				float cellHeight = font->_size * (cfg ? cfg->OversampleV : 1) + 2.0f;
+				int side = (int)ceilf(sqrtf(cellWidth * cellHeight * (float)count));
+				side = std::min(std::max(side, (int)ceilf(std::max(cellWidth, cellHeight))), MV_DYNAMIC_GLYPH_REGION_MAX);
+				dynamic.rectId = io.Fonts->AddCustomRectRegular(side, side);
+				dynamic.cursorX = dynamic.cursorY = dynamic.rowHeight = 0;
+			}
+		}
+
+		// fonts are only rasterized if the atlas isn't cached yet
+		std::string cacheFile;
+		if (!GContext->IO.fontAtlasCache.empty())
+		{
+			char name[64];
+			snprintf(name, 64, "/dpg_font_atlas_%016llx.bin", GetAtlasCacheKey(roots[0]->childslots[1], _globalFontScale));
+			cacheFile = GContext->IO.fontAtlasCache + name;
+		}
+
+		if (cacheFile.empty() || !LoadAtlasCache(*io.Fonts, cacheFile))
+		{
+			io.Fonts->Build();
+			if (!cacheFile.empty())
+				SaveAtlasCache(*io.Fonts, cacheFile);
+		}
+
+		for (auto& item : roots[0]->childslots[1])
+		{
+			static_cast<mvFont*>(item.get())->applyCharRemaps();
 		}
 	}
 
@@ -8,6 +8,11 @@
 
 struct ImFont;
 
+// dynamic glyphs: codepoints of strings entering dpg (and typed
+// characters) are recorded and rasterized for fonts in dynamic mode
+void mvEnableDynamicGlyphs();
+void mvRequestGlyphs(const char* text, size_t size);
+
 class mvFontManager : public mvToolWindow
 {
 
@@ -19,6 +24,7 @@ public:
 	float& getGlobalFontScale() { return _globalFontScale; }
 	void   setGlobalFontScale(float scale);
 	void   resetDefault() { _resetDefault = true; }
+	void   updateDynamicGlyphs();
 
 	mvUUID getUUID() const override { return MV_TOOL_FONT_UUID; }
 	const char* getTitle() const override { return "Font Manager"; }
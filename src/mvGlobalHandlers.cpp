@@ -1,32 +1,207 @@
 #include "mvGlobalHandlers.h"
 #include "mvPyUtils.h"
 #include "mvUtilities.h"
+#include <algorithm>
 
-void mvHandlerRegistry::draw(ImDrawList* drawlist, float x, float y)
+static mvInputEvents s_inputEvents;
+
+// native callbacks get the event as app_data instead of the handler's value
+static void
+AddHandlerJob(mvAppItem& handler, std::function<PyObject*()> appData, const mvNativeAppData& nativeAppData)
+{
+	mvCallbackJob job(handler, std::move(appData));
+	if (job.is_native())
+		job.native.appData = nativeAppData;
+	mvAddCallbackJob(std::move(job), false);
+}
+
+static void
+ClearEvents(std::vector<i32>& events, b8* flags)
+{
+	for (i32 code : events)
+		flags[code] = false;
+	events.clear();
+}
+
+static void
+AddEvent(std::vector<i32>& events, b8* flags, i32 code)
+{
+	events.push_back(code);
+	flags[code] = true;
+}
+
+void mvUpdateInputEvents()
+{
+	mvInputEvents& events = s_inputEvents;
+	const ImGuiIO& io = ImGui::GetIO();
+
+	ClearEvents(events.keysDown, events.keyDown);
+	ClearEvents(events.keysPressed, events.keyPressed);
+	ClearEvents(events.keysReleased, events.keyReleased);
+	ClearEvents(events.buttonsDown, events.buttonDown);
+	ClearEvents(events.buttonsClicked, events.buttonClicked);
+	ClearEvents(events.buttonsDoubleClicked, events.buttonDoubleClicked);
+	ClearEvents(events.buttonsReleased, events.buttonReleased);
+
+	static_assert(IM_ARRAYSIZE(io.KeysDown) == mvInputEvents::KeyCount, "key count mismatch");
+	for (int i = 0; i < mvInputEvents::KeyCount; i++)
+	{
+		if (io.KeysDown[i])
+		{
+			AddEvent(events.keysDown, events.keyDown, i);
+			if (ImGui::IsKeyPressed(i))
+				AddEvent(events.keysPressed, events.keyPressed, i);
+		}
+		else if (io.KeysDownDurationPrev[i] >= 0.0f)
+			AddEvent(events.keysReleased, events.keyReleased, i);
+	}
+
+	for (int i = 0; i < mvInputEvents::ButtonCount; i++)
+	{
+		if (io.MouseDown[i])
+			AddEvent(events.buttonsDown, events.buttonDown, i);
+		if (ImGui::IsMouseClicked(i))
+			AddEvent(events.buttonsClicked, events.buttonClicked, i);
+		if (ImGui::IsMouseDoubleClicked(i))
+			AddEvent(events.buttonsDoubleClicked, events.buttonDoubleClicked, i);
+		if (ImGui::IsMouseReleased(i))
+			AddEvent(events.buttonsReleased, events.buttonReleased, i);
+	}
+
+	events.wheel = (int)io.MouseWheel;
+	events.mouseMoved = io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f;
+	events.any = !events.keysDown.empty() || !events.keysReleased.empty()
+		|| !events.buttonsDown.empty() || !events.buttonsReleased.empty()
+		|| events.wheel != 0 || events.mouseMoved;
+}
+
+const mvInputEvents& mvGetInputEvents()
+{
+	return s_inputEvents;
+}
+
+static bool
+HasEvent(const b8* flags, i32 count, int code)
+{
+	return code >= 0 && code < count && flags[code];
+}
+
+// the table a handler is dispatched from and the key/button it listens to
+static bool
+GetHandlerEvent(mvAppItem* item, i32& event, i32& code)
+{
+	switch (item->type)
+	{
+	case mvAppItemType::mvKeyDownHandler:          event = mvHandlerRegistry::KeyDown;          code = static_cast<mvKeyDownHandler*>(item)->_key; return true;
+	case mvAppItemType::mvKeyPressHandler:         event = mvHandlerRegistry::KeyPress;         code = static_cast<mvKeyPressHandler*>(item)->_key; return true;
+	case mvAppItemType::mvKeyReleaseHandler:       event = mvHandlerRegistry::KeyRelease;       code = static_cast<mvKeyReleaseHandler*>(item)->_key; return true;
+	case mvAppItemType::mvMouseDownHandler:        event = mvHandlerRegistry::MouseDown;        code = static_cast<mvMouseDownHandler*>(item)->_button; return true;
+	case mvAppItemType::mvMouseClickHandler:       event = mvHandlerRegistry::MouseClick;       code = static_cast<mvMouseClickHandler*>(item)->_button; return true;
+	case mvAppItemType::mvMouseDoubleClickHandler: event = mvHandlerRegistry::MouseDoubleClick; code = static_cast<mvMouseDoubleClickHandler*>(item)->_button; return true;
+	case mvAppItemType::mvMouseReleaseHandler:     event = mvHandlerRegistry::MouseRelease;     code = static_cast<mvMouseReleaseHandler*>(item)->_button; return true;
+	case mvAppItemType::mvMouseDragHandler:
+	{
+		// any-button drags also reset on release, those run every frame with input
+		code = static_cast<mvMouseDragHandler*>(item)->_button;
+		event = mvHandlerRegistry::MouseDrag;
+		return code != -1;
+	}
+	default: return false;
+	}
+}
+
+void mvHandlerRegistry::addHandler(mvAppItem* item)
+{
+	i32 event, code;
+	if (!GetHandlerEvent(item, event, code))
+		_always.push_back(item);
+	else if (code == -1)
+		_dispatch[event].any.push_back(item);
+	else
+		_dispatch[event].byCode[code].push_back(item);
+}
+
+void mvHandlerRegistry::removeHandler(mvAppItem* item)
+{
+	auto erase = [item](std::vector<mvAppItem*>& handlers) {
+		handlers.erase(std::remove(handlers.begin(), handlers.end(), item), handlers.end());
+	};
+
+	// looked up everywhere, the key may have changed since it was added
+	erase(_always);
+	for (auto& dispatch : _dispatch)
+	{
+		erase(dispatch.any);
+		for (auto it = dispatch.byCode.begin(); it != dispatch.byCode.end();)
+		{
+			erase(it->second);
+			it = it->second.empty() ? dispatch.byCode.erase(it) : std::next(it);
+		}
+	}
+}
+
+void mvHandlerRegistry::onChildrenRemoved()
 {
+	_always.clear();
+	for (auto& dispatch : _dispatch)
+	{
+		dispatch.any.clear();
+		dispatch.byCode.clear();
+	}
 
 	for (auto& item : childslots[1])
-		item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
+		addHandler(item.get());
+}
+
+static void
+DispatchEvents(const mvHandlerDispatch& dispatch, const std::vector<i32>& codes)
+{
+	if (codes.empty())
+		return;
+
+	for (mvAppItem* item : dispatch.any)
+		item->draw(nullptr, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 
+	for (i32 code : codes)
+	{
+		auto found = dispatch.byCode.find(code);
+		if (found == dispatch.byCode.end())
+			continue;
+		for (mvAppItem* item : found->second)
+			item->draw(nullptr, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
+	}
+}
+
+void mvHandlerRegistry::draw(ImDrawList* drawlist, float x, float y)
+{
+	const mvInputEvents& events = mvGetInputEvents();
+
+	DispatchEvents(_dispatch[KeyDown], events.keysDown);
+	DispatchEvents(_dispatch[KeyPress], events.keysPressed);
+	DispatchEvents(_dispatch[KeyRelease], events.keysReleased);
+	DispatchEvents(_dispatch[MouseDown], events.buttonsDown);
+	DispatchEvents(_dispatch[MouseClick], events.buttonsClicked);
+	DispatchEvents(_dispatch[MouseDoubleClick], events.buttonsDoubleClicked);
+	DispatchEvents(_dispatch[MouseRelease], events.buttonsReleased);
+	DispatchEvents(_dispatch[MouseDrag], events.buttonsDown);
+
+	for (mvAppItem* item : _always)
+		item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 }
 
 void mvKeyDownHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
 
 	if (_key == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
-		{
-			if (ImGui::GetIO().KeysDown[i])
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMPair(i, ImGui::GetIO().KeysDownDuration[i]))}, false);
-			}
-		}
+		for (int i : events.keysDown)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMPair(i, ImGui::GetIO().KeysDownDuration[i])), mvNativeVec((f32)i, ImGui::GetIO().KeysDownDuration[i]));
 	}
 
-	else if (ImGui::GetIO().KeysDown[_key])
+	else if (HasEvent(events.keyDown, mvInputEvents::KeyCount, _key))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMPair(_key, ImGui::GetIO().KeysDownDuration[_key]))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMPair(_key, ImGui::GetIO().KeysDownDuration[_key])), mvNativeVec((f32)_key, ImGui::GetIO().KeysDownDuration[_key]));
 	}
 }
 
@@ -56,20 +231,17 @@ void mvKeyDownHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvKeyPressHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_key == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
-		{
-			if (ImGui::IsKeyPressed(i))
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(i))}, false);
-			}
-		}
+		for (int i : events.keysPressed)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(i)), mvNativeInt(i));
 	}
 
-	else if (ImGui::IsKeyPressed(_key))
+	else if (HasEvent(events.keyPressed, mvInputEvents::KeyCount, _key))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(_key))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(_key)), mvNativeInt(_key));
 	}
 }
 
@@ -111,20 +283,17 @@ void mvKeyPressHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvKeyReleaseHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_key == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
-		{
-			if (ImGui::GetIO().KeysDownDurationPrev[i] >= 0.0f && !ImGui::GetIO().KeysDown[i])
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(i))}, false);
-			}
-		}
+		for (int i : events.keysReleased)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(i)), mvNativeInt(i));
 	}
 
-	else if (ImGui::IsKeyReleased(_key))
+	else if (HasEvent(events.keyReleased, mvInputEvents::KeyCount, _key))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(_key))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(_key)), mvNativeInt(_key));
 	}
 }
 
@@ -166,20 +335,17 @@ void mvKeyReleaseHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvMouseClickHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_button == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-		{
-			if (ImGui::IsMouseClicked(i))
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(i))}, false);
-			}
-		}
+		for (int i : events.buttonsClicked)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(i)), mvNativeInt(i));
 	}
 
-	else if (ImGui::IsMouseClicked(_button))
+	else if (HasEvent(events.buttonClicked, mvInputEvents::ButtonCount, _button))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(_button))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(_button)), mvNativeInt(_button));
 	}
 }
 
@@ -221,20 +387,17 @@ void mvMouseClickHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvMouseDoubleClickHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_button == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-		{
-			if (ImGui::IsMouseDoubleClicked(i))
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(i))}, false);
-			}
-		}
+		for (int i : events.buttonsDoubleClicked)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(i)), mvNativeInt(i));
 	}
 
-	else if (ImGui::IsMouseDoubleClicked(_button))
+	else if (HasEvent(events.buttonDoubleClicked, mvInputEvents::ButtonCount, _button))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(_button))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(_button)), mvNativeInt(_button));
 	}
 }
 
@@ -276,20 +439,17 @@ void mvMouseDoubleClickHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvMouseDownHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_button == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-		{
-			if (ImGui::GetIO().MouseDown[i])
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMPair(i, ImGui::GetIO().MouseDownDuration[i]))}, false);
-			}
-		}
+		for (int i : events.buttonsDown)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMPair(i, ImGui::GetIO().MouseDownDuration[i])), mvNativeVec((f32)i, ImGui::GetIO().MouseDownDuration[i]));
 	}
 
-	else if (ImGui::GetIO().MouseDown[_button])
+	else if (HasEvent(events.buttonDown, mvInputEvents::ButtonCount, _button))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMPair(_button, ImGui::GetIO().MouseDownDuration[_button]))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMPair(_button, ImGui::GetIO().MouseDownDuration[_button])), mvNativeVec((f32)_button, ImGui::GetIO().MouseDownDuration[_button]));
 	}
 }
 
@@ -331,26 +491,27 @@ void mvMouseDownHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvMouseDragHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_button == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-		{
-			if (ImGui::IsMouseReleased(i))
-				ImGui::ResetMouseDragDelta(i);
+		for (int i : events.buttonsReleased)
+			ImGui::ResetMouseDragDelta(i);
 
+		// dragging needs the button held
+		for (int i : events.buttonsDown)
+		{
 			if (ImGui::IsMouseDragging(i, _threshold))
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMTrip(i, ImGui::GetMouseDragDelta(i).x, ImGui::GetMouseDragDelta(i).y))}, false);
-			}
+				AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMTrip(i, ImGui::GetMouseDragDelta(i).x, ImGui::GetMouseDragDelta(i).y)), mvNativeVec((f32)i, ImGui::GetMouseDragDelta(i).x, ImGui::GetMouseDragDelta(i).y));
 		}
 	}
 
-	else if (ImGui::IsMouseDragging(_button, _threshold))
+	else if (HasEvent(events.buttonDown, mvInputEvents::ButtonCount, _button) && ImGui::IsMouseDragging(_button, _threshold))
 	{
 		if (ImGui::IsMouseReleased(_button))
 			ImGui::ResetMouseDragDelta(_button);
 
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyMTrip(_button, ImGui::GetMouseDragDelta(_button).x, ImGui::GetMouseDragDelta(_button).y))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyMTrip(_button, ImGui::GetMouseDragDelta(_button).x, ImGui::GetMouseDragDelta(_button).y)), mvNativeVec((f32)_button, ImGui::GetMouseDragDelta(_button).x, ImGui::GetMouseDragDelta(_button).y));
 	}
 }
 
@@ -408,27 +569,24 @@ void mvMouseMoveHandler::draw(ImDrawList* drawlist, float x, float y)
 		{
 			_oldPos = mousepos;
 
-			mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyPair(mousepos.x, mousepos.y))}, false);
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyPair(mousepos.x, mousepos.y)), mvNativeVec(mousepos.x, mousepos.y));
 		}
 	}
 }
 
 void mvMouseReleaseHandler::draw(ImDrawList* drawlist, float x, float y)
 {
+	const mvInputEvents& events = mvGetInputEvents();
+
 	if (_button == -1)
 	{
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-		{
-			if (ImGui::IsMouseReleased(i))
-			{
-				mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(i))}, false);
-			}
-		}
+		for (int i : events.buttonsReleased)
+			AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(i)), mvNativeInt(i));
 	}
 
-	else if (ImGui::IsMouseReleased(_button))
+	else if (HasEvent(events.buttonReleased, mvInputEvents::ButtonCount, _button))
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(_button))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(_button)), mvNativeInt(_button));
 	}
 }
 
@@ -470,9 +628,9 @@ void mvMouseReleaseHandler::getSpecificConfiguration(PyObject* dict)
 
 void mvMouseWheelHandler::draw(ImDrawList* drawlist, float x, float y)
 {
-	int wheel = (int)ImGui::GetIO().MouseWheel;
+	int wheel = mvGetInputEvents().wheel;
 	if (wheel)
 	{
-		mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(wheel))}, false);
+		AddHandlerJob(*this, MV_APP_DATA_FUNC(ToPyInt(wheel)), mvNativeInt(wheel));
 	}
 }
@@ -4,11 +4,77 @@
 #include "mvItemRegistry.h"
 #include "dearpygui.h"
 
+//-----------------------------------------------------------------------------
+// mvInputEvents
+//
+//     - What changed this frame, diffed once for all global handlers.
+//     - Lists hold the keys/buttons with an event (for handlers listening
+//       to any key), the arrays are indexed by key/button (for handlers
+//       listening to one).
+//-----------------------------------------------------------------------------
+
+struct mvInputEvents
+{
+    static constexpr i32 KeyCount    = 512;
+    static constexpr i32 ButtonCount = 5;
+
+    std::vector<i32> keysDown;
+    std::vector<i32> keysPressed;  // includes repeats
+    std::vector<i32> keysReleased;
+    std::vector<i32> buttonsDown;
+    std::vector<i32> buttonsClicked;
+    std::vector<i32> buttonsDoubleClicked;
+    std::vector<i32> buttonsReleased;
+    b8               keyDown[KeyCount] = {};
+    b8               keyPressed[KeyCount] = {};
+    b8               keyReleased[KeyCount] = {};
+    b8               buttonDown[ButtonCount] = {};
+    b8               buttonClicked[ButtonCount] = {};
+    b8               buttonDoubleClicked[ButtonCount] = {};
+    b8               buttonReleased[ButtonCount] = {};
+    i32              wheel = 0;
+    b8               mouseMoved = false;
+    b8               any = false; // false: no handler can fire this frame
+};
+
+void                 mvUpdateInputEvents(); // once per frame, before the handler registries draw
+const mvInputEvents& mvGetInputEvents();
+
+//-----------------------------------------------------------------------------
+// mvHandlerDispatch
+//
+//     - Handlers of one event kind, kept by the registry as children come
+//       and go so a frame only visits handlers whose key/button had an event.
+//-----------------------------------------------------------------------------
+
+struct mvHandlerDispatch
+{
+    std::vector<mvAppItem*>                          any;    // key/button -1
+    std::unordered_map<i32, std::vector<mvAppItem*>> byCode;
+};
+
 class mvHandlerRegistry : public mvAppItem
 {
 public:
+    enum Event
+    {
+        KeyDown, KeyPress, KeyRelease,
+        MouseDown, MouseClick, MouseDoubleClick, MouseRelease, MouseDrag,
+        EventCount
+    };
+
     explicit mvHandlerRegistry(mvUUID uuid) : mvAppItem(uuid) {}
     void draw(ImDrawList* drawlist, float x, float y) override;
+    void onChildAdd(std::shared_ptr<mvAppItem> item) { addHandler(item.get()); }
+    void onChildRemoved(std::shared_ptr<mvAppItem> item) { removeHandler(item.get()); }
+    void onChildrenRemoved(); // children cleared, replaced or reconfigured, rebuilds the tables
+
+private:
+    void addHandler(mvAppItem* item);
+    void removeHandler(mvAppItem* item);
+
+    mvHandlerDispatch       _dispatch[EventCount];
+    std::vector<mvAppItem*> _always; // move, wheel and any-button drag handlers
 };
 
 class mvKeyDownHandler : public mvAppItem
@@ -16,4 +16,5 @@ struct mvGraphics
 {
     bool           ok = false;
     void* backendSpecifics = nullptr;
+    int            swapInterval = -1; // last interval set on the context, -1 until the first present
 };
\ No newline at end of file
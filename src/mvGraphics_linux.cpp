@@ -34,7 +34,12 @@ present(mvGraphics& graphics, mvColor& clearColor, bool vsync)
 
     glfwGetWindowPos(viewportData->handle, &viewport->xpos, &viewport->ypos);
 
-    glfwSwapInterval(viewport->vsync ? 1 : 0); // Enable vsync
+    // only touch the swap interval when vsync changes, it can stall the driver
+    if (graphics.swapInterval != (viewport->vsync ? 1 : 0))
+    {
+        graphics.swapInterval = viewport->vsync ? 1 : 0;
+        glfwSwapInterval(graphics.swapInterval);
+    }
 
     // Rendering
     ImGui::Render();
@@ -0,0 +1,236 @@
+#include "mvInputRecorder.h"
+#include <chrono>
+#include <cstring>
+#include <imgui.h>
+#include "mvContext.h"
+#include "mvViewport.h"
+#include "mvFontManager.h"
+#include "mvToolManager.h"
+
+static const char MV_INPUT_MAGIC[4] = { 'D', 'P', 'G', 'I' };
+static const u32  MV_INPUT_VERSION = 2;
+static const i32  MV_REPLAY_KEY_BASE = IM_ARRAYSIZE(ImGuiIO::KeysDown) - ImGuiKey_COUNT;
+
+template<typename T>
+static bool
+ReadValue(FILE* file, T& value)
+{
+    return fread(&value, sizeof(T), 1, file) == 1;
+}
+
+template<typename T>
+static bool
+ReadArray(FILE* file, std::vector<T>& values, u16 count)
+{
+    values.resize(count);
+    return count == 0 || fread(values.data(), sizeof(T), count, file) == count;
+}
+
+bool
+mvStartInputRecording(mvInputRecorder& recorder, const std::string& file)
+{
+    mvStopInputRecording(recorder);
+
+    recorder.recording = fopen(file.c_str(), "wb");
+    if (recorder.recording == nullptr)
+        return false;
+
+    fwrite(MV_INPUT_MAGIC, 1, 4, recorder.recording);
+    fwrite(&MV_INPUT_VERSION, sizeof(u32), 1, recorder.recording);
+    return true;
+}
+
+void
+mvStopInputRecording(mvInputRecorder& recorder)
+{
+    if (recorder.recording == nullptr)
+        return;
+
+    fclose(recorder.recording);
+    recorder.recording = nullptr;
+}
+
+void
+mvRecordInputFrame(mvInputRecorder& recorder)
+{
+    if (recorder.recording == nullptr)
+        return;
+
+    // the state NewFrame consumed, wheel and text are cleared by EndFrame
+    const ImGuiIO& io = ImGui::GetIO();
+    mvInputFrame frame;
+    frame.deltaTime = io.DeltaTime;
+    frame.displaySize[0] = io.DisplaySize.x;
+    frame.displaySize[1] = io.DisplaySize.y;
+    frame.mousePos[0] = io.MousePos.x;
+    frame.mousePos[1] = io.MousePos.y;
+    frame.wheel[0] = io.MouseWheel;
+    frame.wheel[1] = io.MouseWheelH;
+    for (i32 i = 0; i < 5; i++)
+    {
+        if (io.MouseDown[i])
+            frame.mouseDown |= (u8)(1 << i);
+    }
+    frame.modifiers = (io.KeyCtrl ? 1 : 0) | (io.KeyShift ? 2 : 0) | (io.KeyAlt ? 4 : 0) | (io.KeySuper ? 8 : 0);
+    for (i32 i = 0; i < IM_ARRAYSIZE(io.KeysDown); i++)
+    {
+        if (io.KeysDown[i])
+            frame.keysDown.push_back((u16)i);
+    }
+    for (i32 i = 0; i < io.InputQueueCharacters.Size; i++)
+        frame.chars.push_back((u32)io.InputQueueCharacters[i]);
+    for (i32 i = 0; i < ImGuiKey_COUNT; i++)
+    {
+        i32 key = io.KeyMap[i];
+        if (key >= 0 && key < IM_ARRAYSIZE(io.KeysDown) && io.KeysDown[key])
+            frame.namedKeys.push_back((u16)i);
+    }
+
+    u16 keyCount = (u16)frame.keysDown.size();
+    u16 charCount = (u16)frame.chars.size();
+    u16 namedCount = (u16)frame.namedKeys.size();
+    FILE* file = recorder.recording;
+    fwrite(&frame.deltaTime, sizeof(f32), 1, file);
+    fwrite(frame.displaySize, sizeof(f32), 2, file);
+    fwrite(frame.mousePos, sizeof(f32), 2, file);
+    fwrite(frame.wheel, sizeof(f32), 2, file);
+    fwrite(&frame.mouseDown, sizeof(u8), 1, file);
+    fwrite(&frame.modifiers, sizeof(u8), 1, file);
+    fwrite(&keyCount, sizeof(u16), 1, file);
+    fwrite(&charCount, sizeof(u16), 1, file);
+    fwrite(&namedCount, sizeof(u16), 1, file);
+    fwrite(frame.keysDown.data(), sizeof(u16), keyCount, file);
+    fwrite(frame.chars.data(), sizeof(u32), charCount, file);
+    fwrite(frame.namedKeys.data(), sizeof(u16), namedCount, file);
+}
+
+bool
+mvStartInputReplay(mvInputRecorder& recorder, const std::string& file, f32 timeStep)
+{
+    FILE* input = fopen(file.c_str(), "rb");
+    if (input == nullptr)
+        return false;
+
+    char magic[4] = {};
+    u32 version = 0;
+    bool ok = fread(magic, 1, 4, input) == 4 && memcmp(magic, MV_INPUT_MAGIC, 4) == 0
+        && ReadValue(input, version) && (version == 1 || version == MV_INPUT_VERSION);
+
+    std::vector<mvInputFrame> frames;
+    while (ok)
+    {
+        mvInputFrame frame;
+        u16 keyCount = 0;
+        u16 charCount = 0;
+        u16 namedCount = 0;
+        if (!ReadValue(input, frame.deltaTime))
+            break; // end of file
+        ok = ReadValue(input, frame.displaySize) && ReadValue(input, frame.mousePos) && ReadValue(input, frame.wheel)
+            && ReadValue(input, frame.mouseDown) && ReadValue(input, frame.modifiers)
+            && ReadValue(input, keyCount) && ReadValue(input, charCount)
+            && (version == 1 || ReadValue(input, namedCount))
+            && ReadArray(input, frame.keysDown, keyCount) && ReadArray(input, frame.chars, charCount)
+            && ReadArray(input, frame.namedKeys, namedCount);
+        if (ok)
+            frames.push_back(std::move(frame));
+    }
+    fclose(input);
+
+    if (!ok)
+        return false;
+
+    recorder.replay = std::move(frames);
+    recorder.replayFrame = 0;
+    recorder.timeStep = timeStep;
+    recorder.frameTimes.clear();
+    recorder.replaying = true;
+
+    // what mvShowViewport would have set up
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    if (GContext->IO.kbdNavigation)
+        io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    if (GContext->IO.docking)
+        io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+    // named keys get the top slots of KeysDown, above any backend key code
+    for (i32 i = 0; i < ImGuiKey_COUNT; i++)
+        io.KeyMap[i] = MV_REPLAY_KEY_BASE + i;
+    ImGui::StyleColorsDark();
+    SetDefaultTheme();
+    return true;
+}
+
+void
+mvStopInputReplay(mvInputRecorder& recorder)
+{
+    recorder.replaying = false;
+    recorder.replay.clear();
+    recorder.replayFrame = 0;
+}
+
+void
+mvRenderReplayFrame(mvInputRecorder& recorder)
+{
+    mvInputFrame frame;
+    {
+        std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+        if (recorder.replayFrame >= recorder.replay.size())
+        {
+            GContext->started = false;
+            return;
+        }
+        frame = recorder.replay[recorder.replayFrame++];
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // no renderer, the atlas only has to exist on the CPU
+    ImGuiIO& io = ImGui::GetIO();
+    mvFontManager& fontManager = mvToolManager::GetFontManager();
+    if (fontManager.isInvalid())
+        fontManager.rebuildAtlas();
+    if (!io.Fonts->IsBuilt())
+        io.Fonts->Build();
+
+    io.DeltaTime = recorder.timeStep > 0.0f ? recorder.timeStep : frame.deltaTime;
+    if (io.DeltaTime <= 0.0f)
+        io.DeltaTime = 1.0f / 60.0f;
+    io.DisplaySize = ImVec2(frame.displaySize[0], frame.displaySize[1]);
+    io.MousePos = ImVec2(frame.mousePos[0], frame.mousePos[1]);
+    io.MouseWheel = frame.wheel[0];
+    io.MouseWheelH = frame.wheel[1];
+    for (i32 i = 0; i < 5; i++)
+        io.MouseDown[i] = (frame.mouseDown >> i) & 1;
+    io.KeyCtrl = (frame.modifiers & 1) != 0;
+    io.KeyShift = (frame.modifiers & 2) != 0;
+    io.KeyAlt = (frame.modifiers & 4) != 0;
+    io.KeySuper = (frame.modifiers & 8) != 0;
+    memset(io.KeysDown, 0, sizeof(io.KeysDown));
+    for (u16 key : frame.keysDown)
+    {
+        if (key < MV_REPLAY_KEY_BASE)
+            io.KeysDown[key] = true;
+    }
+    for (u16 key : frame.namedKeys)
+    {
+        if (key < ImGuiKey_COUNT)
+            io.KeysDown[MV_REPLAY_KEY_BASE + key] = true;
+    }
+    for (u32 c : frame.chars)
+        io.AddInputCharacter(c);
+
+    if (mvViewport* viewport = GContext->viewport)
+    {
+        viewport->actualWidth = viewport->clientWidth = (i32)frame.displaySize[0];
+        viewport->actualHeight = viewport->clientHeight = (i32)frame.displaySize[1];
+    }
+
+    ImGui::NewFrame();
+    Render();
+    ImGui::Render();
+
+    std::chrono::duration<f64> elapsed = std::chrono::steady_clock::now() - start;
+    std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
+    recorder.frameTimes.push_back(elapsed.count());
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "mvTypes.h"
+
+//-----------------------------------------------------------------------------
+// mvInputRecorder
+//
+//     - Records the input ImGui sees each frame (display size, frame delta,
+//       mouse, wheel, keys, modifiers, text) into a compact binary file.
+//     - Replays a recording without a window system, one recorded frame per
+//       render_dearpygui_frame, for reproducible performance runs.
+//
+//     - Keys ImGui knows by name are stored as ImGuiKey values, so navigation
+//       and widget input replay on any backend. The raw backend key codes
+//       are kept as well for key handlers, these only match the backend the
+//       recording was made with.
+//
+//     file layout (native byte order):
+//       header : "DPGI", u32 version
+//       frame  : f32 deltaTime, f32 displaySize[2], f32 mousePos[2],
+//                f32 wheel[2], u8 mouseDown bits, u8 modifier bits,
+//                u16 keyCount, u16 charCount, u16 namedCount,
+//                u16 keysDown[keyCount], u32 chars[charCount],
+//                u16 namedKeys[namedCount]
+//       (version 1 files have no namedCount/namedKeys)
+//-----------------------------------------------------------------------------
+
+struct mvInputFrame
+{
+    f32              deltaTime = 0.0f;
+    f32              displaySize[2] = { 0.0f, 0.0f };
+    f32              mousePos[2] = { 0.0f, 0.0f };
+    f32              wheel[2] = { 0.0f, 0.0f }; // vertical, horizontal
+    u8               mouseDown = 0;             // bit per button
+    u8               modifiers = 0;             // ctrl, shift, alt, super
+    std::vector<u16> keysDown;                  // backend key codes
+    std::vector<u32> chars;
+    std::vector<u16> namedKeys;                 // ImGuiKey values
+};
+
+struct mvInputRecorder
+{
+    FILE*                     recording = nullptr;
+    bool                      replaying = false;
+    std::vector<mvInputFrame> replay;
+    size_t                    replayFrame = 0;
+    f32                       timeStep = 0.0f; // 0 replays the recorded deltas
+    std::vector<f64>          frameTimes;      // seconds spent on each replayed frame
+};
+
+bool mvStartInputRecording(mvInputRecorder& recorder, const std::string& file);
+void mvStopInputRecording (mvInputRecorder& recorder);
+void mvRecordInputFrame   (mvInputRecorder& recorder); // between ImGui::NewFrame and ImGui::EndFrame
+bool mvStartInputReplay   (mvInputRecorder& recorder, const std::string& file, f32 timeStep);
+void mvStopInputReplay    (mvInputRecorder& recorder);
+void mvRenderReplayFrame  (mvInputRecorder& recorder); // replaces mvRenderFrame while replaying
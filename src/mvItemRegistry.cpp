@@ -301,6 +301,8 @@ MoveChildUp(mvAppItem* item, mvUUID uuid)
                 childset[index] = upperitem;
                 childset[index - 1] = loweritem;
 
+                DearPyGui::OnChildrenReordered(item);
+
                 UpdateChildLocations(item->childslots, 4);
             }
 
@@ -360,6 +362,8 @@ MoveChildDown(mvAppItem* item, mvUUID uuid)
                 childset[index] = loweritem;
                 childset[index + 1] = upperitem;
 
+                DearPyGui::OnChildrenReordered(item);
+
                 UpdateChildLocations(item->childslots, 4);
             }
 
@@ -826,6 +830,35 @@ GetItemRoot(mvItemRegistry& registry, mvUUID uuid)
     return nullptr;
 }
 
+u32
+GetSourceVersion(mvItemRegistry& registry, mvUUID source)
+{
+    // values are shared down a chain of sources, so a change to any item
+    // in the chain changes the sum (versions only ever grow)
+    u32 version = 0;
+    for (i32 depth = 0; source != 0 && depth < 16; depth++)
+    {
+        mvAppItem* item = GetItem(registry, source);
+        if (item == nullptr)
+            break;
+        version += item->info.valueVersion;
+        source = item->config.source;
+    }
+    return version;
+}
+
+void
+BumpValueVersion(mvItemRegistry& registry, mvAppItem* item)
+{
+    // writes through a shared value reach every item sharing it, so the
+    // whole chain up to the owner of the value moves
+    for (i32 depth = 0; item != nullptr && depth < 16; depth++)
+    {
+        item->info.valueVersion++;
+        item = item->config.source != 0 ? GetItem(registry, item->config.source) : nullptr;
+    }
+}
+
 b8
 DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
 {
@@ -852,6 +885,10 @@ DeleteItem(mvItemRegistry& registry, mvUUID uuid, b8 childrenOnly, i32 slot)
                 
             if(item->type == mvAppItemType::mvTable)
                 static_cast<mvTable*>(item)->onChildrenRemoved();
+            else if(item->type == mvAppItemType::mvFilterSet)
+                static_cast<mvFilterSet*>(item)->onChildrenRemoved();
+            else if(item->type == mvAppItemType::mvHandlerRegistry)
+                static_cast<mvHandlerRegistry*>(item)->onChildrenRemoved();
 
             return true;
         }
@@ -1045,10 +1082,15 @@ RenderItemRegistry(mvItemRegistry& registry)
         mvToolManager::GetFontManager()._newDefault = false;
     }
 
-    for (auto& root : registry.handlerRegistryRoots)
+    // handlers only look up what changed this frame (see mvUpdateInputEvents),
+    // nothing is walked on frames without input
+    if (mvGetInputEvents().any)
     {
-        if (root->config.show)
-            root->draw(nullptr, 0.0f, 0.0f);
+        for (auto& root : registry.handlerRegistryRoots)
+        {
+            if (root->config.show)
+                root->draw(nullptr, 0.0f, 0.0f);
+        }
     }
 
     for (auto& root : registry.textureRegistryRoots)
@@ -1311,6 +1353,115 @@ CleanUpItem(mvItemRegistry& registry, mvUUID uuid)
             registry.cachedItemsPTR[i] = nullptr;
         }
     }
+
+    ForgetScalarCell(registry, uuid);
+}
+
+static b8
+IsScalarCellType(mvAppItemType type)
+{
+    // only items whose setPyValue is a plain store into the cell
+    switch (type)
+    {
+    case mvAppItemType::mvIntValue:
+    case mvAppItemType::mvFloatValue:
+    case mvAppItemType::mvDoubleValue:
+    case mvAppItemType::mvBoolValue:
+    case mvAppItemType::mvCheckbox:
+    case mvAppItemType::mvSelectable:
+    case mvAppItemType::mvMenuItem:
+    case mvAppItemType::mvProgressBar:
+    case mvAppItemType::mvKnobFloat:
+    case mvAppItemType::mvDragInt:
+    case mvAppItemType::mvDragFloat:
+    case mvAppItemType::mvDragDouble:
+    case mvAppItemType::mvSliderInt:
+    case mvAppItemType::mvSliderFloat:
+    case mvAppItemType::mvSliderDouble:
+    case mvAppItemType::mvDragLine: return true;
+    default: return false;
+    }
+}
+
+void
+CacheScalarCell(mvItemRegistry& registry, mvAppItem* item)
+{
+    if (item == nullptr || !IsScalarCellType(item->type) || item->getValue() == nullptr)
+        return;
+
+    mvScalarCell scalar;
+    scalar.type = DearPyGui::GetEntityValueType(item->type);
+    switch (scalar.type)
+    {
+    case StorageValueTypes::Int:    scalar.cell = *static_cast<std::shared_ptr<std::atomic<int>>*>(item->getValue()); break;
+    case StorageValueTypes::Float:  scalar.cell = *static_cast<std::shared_ptr<std::atomic<float>>*>(item->getValue()); break;
+    case StorageValueTypes::Double: scalar.cell = *static_cast<std::shared_ptr<std::atomic<double>>*>(item->getValue()); break;
+    case StorageValueTypes::Bool:   scalar.cell = *static_cast<std::shared_ptr<std::atomic<bool>>*>(item->getValue()); break;
+    default: return;
+    }
+
+    if (scalar.cell == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lk(registry.scalarMutex);
+    registry.scalarCells[item->uuid] = scalar;
+
+    // only aliases the registry resolves to this item
+    if (!item->config.alias.empty() && GetIdFromAlias(registry, item->config.alias) == item->uuid)
+        registry.scalarAliases[item->config.alias] = item->uuid;
+}
+
+b8
+SetScalarCell(mvItemRegistry& registry, PyObject* item, PyObject* value)
+{
+    if (item == nullptr || value == nullptr)
+        return false;
+
+    mvScalarCell scalar;
+    {
+        std::lock_guard<std::mutex> lk(registry.scalarMutex);
+
+        mvUUID uuid = 0;
+        if (isPyObject_Int(item))
+            uuid = ToUUID(item);
+        else if (isPyObject_String(item))
+        {
+            auto alias = registry.scalarAliases.find(ToString(item));
+            if (alias == registry.scalarAliases.end())
+                return false;
+            uuid = alias->second;
+        }
+
+        auto found = registry.scalarCells.find(uuid);
+        if (found == registry.scalarCells.end())
+            return false;
+        scalar = found->second;
+    }
+
+    // the cell is kept alive by our reference even if the item is deleted meanwhile
+    switch (scalar.type)
+    {
+    case StorageValueTypes::Int:    static_cast<std::atomic<int>*>(scalar.cell.get())->store(ToInt(value)); break;
+    case StorageValueTypes::Float:  static_cast<std::atomic<float>*>(scalar.cell.get())->store(ToFloat(value)); break;
+    case StorageValueTypes::Double: static_cast<std::atomic<double>*>(scalar.cell.get())->store(ToDouble(value)); break;
+    case StorageValueTypes::Bool:   static_cast<std::atomic<bool>*>(scalar.cell.get())->store(ToBool(value)); break;
+    default: return false;
+    }
+    return true;
+}
+
+void
+ForgetScalarCell(mvItemRegistry& registry, mvUUID uuid)
+{
+    std::lock_guard<std::mutex> lk(registry.scalarMutex);
+    registry.scalarCells.erase(uuid);
+}
+
+void
+ForgetScalarAlias(mvItemRegistry& registry, const std::string& alias)
+{
+    std::lock_guard<std::mutex> lk(registry.scalarMutex);
+    registry.scalarAliases.erase(alias);
 }
 
 b8
@@ -1546,6 +1697,7 @@ AddAlias(mvItemRegistry& registry, const std::string& alias, mvUUID id)
     }
 
     registry.aliases[alias] = id;
+    ForgetScalarAlias(registry, alias);
 
     mvAppItem* item = GetItem(registry, id);
     if (item)
@@ -1570,6 +1722,8 @@ RemoveAlias(mvItemRegistry& registry, const std::string& alias, b8 itemTriggered
     if (item)
         item->config.alias.clear();
 
+    ForgetScalarAlias(registry, alias);
+
     if (itemTriggered)
     {
         if (!GContext->IO.manualAliasManagement)
@@ -43,12 +43,31 @@ mvAppItem*       GetItem        (mvItemRegistry& registry, mvUUID uuid);
 std::shared_ptr<mvAppItem> GetRefItem     (mvItemRegistry& registry, mvUUID uuid);
 mvWindowAppItem* GetWindow      (mvItemRegistry& registry, mvUUID uuid);
 mvAppItem*       GetItemRoot    (mvItemRegistry& registry, mvUUID uuid);
+u32              GetSourceVersion(mvItemRegistry& registry, mvUUID source); // valueVersion summed along the source chain
+void             BumpValueVersion(mvItemRegistry& registry, mvAppItem* item);  // the item and every source it shares a value with
+
+// scalar value cells (lock-free set_value)
+void             CacheScalarCell  (mvItemRegistry& registry, mvAppItem* item);
+b8               SetScalarCell    (mvItemRegistry& registry, PyObject* item, PyObject* value);
+void             ForgetScalarCell (mvItemRegistry& registry, mvUUID uuid);
+void             ForgetScalarAlias(mvItemRegistry& registry, const std::string& alias);
 
 // item operations
 void             DelaySearch             (mvItemRegistry& registry, mvAppItem* item);
 b8               AddItemWithRuntimeChecks(mvItemRegistry& registry, std::shared_ptr<mvAppItem> item, mvUUID parent, mvUUID before);
 void             ResetTheme              (mvItemRegistry& registry);
 
+//-----------------------------------------------------------------------------
+// mvScalarCell
+//     - shared ownership of a scalar item's value (std::atomic<T> by type)
+//-----------------------------------------------------------------------------
+
+struct mvScalarCell
+{
+    StorageValueTypes     type = StorageValueTypes::None;
+    std::shared_ptr<void> cell = nullptr;
+};
+
 //-----------------------------------------------------------------------------
 // mvItemRegistry
 //     - Responsibilities:
@@ -75,6 +94,11 @@ struct mvItemRegistry
     mvUUID     cachedContainersID[CachedContainerCount];
     mvAppItem* cachedContainersPTR[CachedContainerCount];
 
+    // scalar value cells, guarded by scalarMutex instead of GContext->mutex
+    std::mutex                               scalarMutex;
+    std::unordered_map<mvUUID, mvScalarCell> scalarCells;
+    std::unordered_map<std::string, mvUUID>  scalarAliases;
+
     // misc
     std::stack<mvAppItem*>                  containers;      // parent stack, top of stack becomes widget's parent
     std::unordered_map<std::string, mvUUID> aliases;
@@ -1,5 +1,15 @@
 #include "mvMath.h"
 
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define MV_SIMD_LANES 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define MV_SIMD_LANES 4
+#else
+    #define MV_SIMD_LANES 1
+#endif
+
 mvVec2::operator ImVec2()
 {
     return ImVec2{ x, y };
@@ -589,4 +599,158 @@ mvFPSViewRH(mvVec3 eye, float pitch, float yaw)
     );
 
     return viewMatrix;
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+// batched transforms
+//-----------------------------------------------------------------------------
+
+#if MV_SIMD_LANES == 8
+typedef __m256 mvLanes;
+static inline mvLanes mvLanesSet  (f32 v)                { return _mm256_set1_ps(v); }
+static inline mvLanes mvLanesLoad (const f32* v)         { return _mm256_load_ps(v); }
+static inline void    mvLanesStore(f32* d, mvLanes v)    { _mm256_store_ps(d, v); }
+static inline mvLanes mvLanesAdd  (mvLanes a, mvLanes b) { return _mm256_add_ps(a, b); }
+static inline mvLanes mvLanesMul  (mvLanes a, mvLanes b) { return _mm256_mul_ps(a, b); }
+static inline mvLanes mvLanesDiv  (mvLanes a, mvLanes b) { return _mm256_div_ps(a, b); }
+static inline i32     mvLanesOutside(mvLanes v, mvLanes lo, mvLanes hi)
+{
+    return _mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(v, lo, _CMP_LT_OQ), _mm256_cmp_ps(v, hi, _CMP_GT_OQ)));
+}
+#elif MV_SIMD_LANES == 4
+typedef __m128 mvLanes;
+static inline mvLanes mvLanesSet  (f32 v)                { return _mm_set1_ps(v); }
+static inline mvLanes mvLanesLoad (const f32* v)         { return _mm_load_ps(v); }
+static inline void    mvLanesStore(f32* d, mvLanes v)    { _mm_store_ps(d, v); }
+static inline mvLanes mvLanesAdd  (mvLanes a, mvLanes b) { return _mm_add_ps(a, b); }
+static inline mvLanes mvLanesMul  (mvLanes a, mvLanes b) { return _mm_mul_ps(a, b); }
+static inline mvLanes mvLanesDiv  (mvLanes a, mvLanes b) { return _mm_div_ps(a, b); }
+static inline i32     mvLanesOutside(mvLanes v, mvLanes lo, mvLanes hi)
+{
+    return _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(v, lo), _mm_cmpgt_ps(v, hi)));
+}
+#endif
+
+static inline void
+mvLoadPoint(const f32* point, i32 components, f32& x, f32& y, f32& z, f32& w)
+{
+    x = point[0];
+    y = point[1];
+    z = components > 2 ? point[2] : 0.0f;
+    w = components > 3 ? point[3] : 1.0f;
+}
+
+static inline bool
+mvStorePoint(size_t i, f32 x, f32 y, f32 z, f32 w, bool outside,
+    mvVec4* out4, ImVec2* out2, mvVec2 offset, u8* clipped)
+{
+    if (out4) out4[i] = mvVec4{ x, y, z, w };
+    if (out2) out2[i] = ImVec2(x + offset.x, y + offset.y);
+    if (clipped) clipped[i] = outside;
+    return outside;
+}
+
+size_t
+mvTransformPoints(const mvMat4& m, const f32* points, i32 components, size_t stride, size_t count,
+    bool perspectiveDivide, const f32* clipViewport, mvVec4* out4, ImVec2* out2, mvVec2 offset, u8* clipped)
+{
+    const mvVec4* c = m.cols;
+    size_t clippedCount = 0;
+    size_t i = 0;
+
+    // clip bounds (see mvClipPoint)
+    f32 lo[3] = { 0.0f, 0.0f, 0.0f };
+    f32 hi[3] = { 0.0f, 0.0f, 0.0f };
+    if (clipViewport)
+    {
+        lo[0] = clipViewport[0];                   hi[0] = clipViewport[0] + clipViewport[2];
+        lo[1] = clipViewport[1] - clipViewport[3]; hi[1] = clipViewport[1];
+        lo[2] = clipViewport[4];                   hi[2] = clipViewport[5];
+    }
+
+#if MV_SIMD_LANES > 1
+    mvLanes mc[4][4];
+    for (i32 col = 0; col < 4; col++)
+    {
+        mc[col][0] = mvLanesSet(c[col].x);
+        mc[col][1] = mvLanesSet(c[col].y);
+        mc[col][2] = mvLanesSet(c[col].z);
+        mc[col][3] = mvLanesSet(c[col].w);
+    }
+    mvLanes lanesLo[3] = { mvLanesSet(lo[0]), mvLanesSet(lo[1]), mvLanesSet(lo[2]) };
+    mvLanes lanesHi[3] = { mvLanesSet(hi[0]), mvLanesSet(hi[1]), mvLanesSet(hi[2]) };
+
+    alignas(32) f32 in[4][MV_SIMD_LANES];
+    alignas(32) f32 res[4][MV_SIMD_LANES];
+
+    for (; i + MV_SIMD_LANES <= count; i += MV_SIMD_LANES)
+    {
+        for (i32 lane = 0; lane < MV_SIMD_LANES; lane++)
+            mvLoadPoint(&points[(i + lane) * stride], components, in[0][lane], in[1][lane], in[2][lane], in[3][lane]);
+
+        mvLanes x = mvLanesLoad(in[0]);
+        mvLanes y = mvLanesLoad(in[1]);
+        mvLanes z = mvLanesLoad(in[2]);
+        mvLanes w = mvLanesLoad(in[3]);
+
+        mvLanes r[4];
+        for (i32 row = 0; row < 4; row++)
+        {
+            r[row] = mvLanesAdd(
+                mvLanesAdd(mvLanesMul(mc[0][row], x), mvLanesMul(mc[1][row], y)),
+                mvLanesAdd(mvLanesMul(mc[2][row], z), mvLanesMul(mc[3][row], w)));
+        }
+
+        if (perspectiveDivide)
+        {
+            r[0] = mvLanesDiv(r[0], r[3]);
+            r[1] = mvLanesDiv(r[1], r[3]);
+            r[2] = mvLanesDiv(r[2], r[3]);
+        }
+
+        i32 outside = 0;
+        if (clipViewport)
+        {
+            outside = mvLanesOutside(r[0], lanesLo[0], lanesHi[0])
+                | mvLanesOutside(r[1], lanesLo[1], lanesHi[1])
+                | mvLanesOutside(r[2], lanesLo[2], lanesHi[2]);
+        }
+
+        for (i32 row = 0; row < 4; row++)
+            mvLanesStore(res[row], r[row]);
+
+        for (i32 lane = 0; lane < MV_SIMD_LANES; lane++)
+        {
+            if (mvStorePoint(i + lane, res[0][lane], res[1][lane], res[2][lane], res[3][lane],
+                (outside >> lane) & 1, out4, out2, offset, clipped))
+                clippedCount++;
+        }
+    }
+#endif
+
+    // remainder (and scalar fallback)
+    for (; i < count; i++)
+    {
+        f32 x, y, z, w;
+        mvLoadPoint(&points[i * stride], components, x, y, z, w);
+
+        f32 rx = (c[0].x * x + c[1].x * y) + (c[2].x * z + c[3].x * w);
+        f32 ry = (c[0].y * x + c[1].y * y) + (c[2].y * z + c[3].y * w);
+        f32 rz = (c[0].z * x + c[1].z * y) + (c[2].z * z + c[3].z * w);
+        f32 rw = (c[0].w * x + c[1].w * y) + (c[2].w * z + c[3].w * w);
+
+        if (perspectiveDivide)
+        {
+            rx = rx / rw;
+            ry = ry / rw;
+            rz = rz / rw;
+        }
+
+        bool outside = clipViewport && (rx < lo[0] || rx > hi[0] || ry < lo[1] || ry > hi[1] || rz < lo[2] || rz > hi[2]);
+
+        if (mvStorePoint(i, rx, ry, rz, rw, outside, out4, out2, offset, clipped))
+            clippedCount++;
+    }
+
+    return clippedCount;
+}
@@ -97,6 +97,18 @@ mvMat4 mvRotate(mvMat4 m, f32 angle, mvVec3 v);
 mvMat4 mvScale(mvMat4 m, mvVec3 v);
 mvMat4 mvOrthoRH(f32 left, f32 right, f32 bottom, f32 top, f32 zNear, f32 zFar);
 mvMat4 mvPerspectiveRH(f32 fovy, f32 aspect, f32 zNear, f32 zFar);
+
+// batched point transform (SSE/AVX when available, scalar otherwise)
+//   * reads "count" points of "components" (2-4) floats spaced "stride" floats apart
+//   * missing components default to z = 0, w = 1
+//   * optional perspective divide and clip test (clipViewport may be null)
+//   * out4 receives xyzw, out2 receives xy + offset, clipped receives 1 per
+//     clipped point; any of them may be null
+//   * returns the number of clipped points
+size_t mvTransformPoints(const mvMat4& m, const f32* points, i32 components, size_t stride, size_t count,
+	bool perspectiveDivide, const f32* clipViewport, mvVec4* out4, ImVec2* out2 = nullptr,
+	mvVec2 offset = { 0.0f, 0.0f }, u8* clipped = nullptr);
+
 mvMat4 mvCreateMatrix(
 	f32 m00, f32 m01, f32 m02, f32 m03,
 	f32 m10, f32 m11, f32 m12, f32 m13,
@@ -422,12 +422,20 @@ void mvNode::draw(ImDrawList* drawlist, float x, float y)
         ImNodes::EndNodeTitleBar();
 
         state.lastFrameUpdate = GContext->frame;
-        state.leftclicked = ImGui::IsItemClicked();
-        state.rightclicked = ImGui::IsItemClicked(1);
-        state.middleclicked = ImGui::IsItemClicked(2);
-        for (int i = 0; i < state.doubleclicked.size(); i++)
+        if (ImGui::IsItemHovered()) // clicks require the title bar to be hovered
         {
-            state.doubleclicked[i] = IsItemDoubleClicked(i);
+            state.leftclicked = ImGui::IsItemClicked();
+            state.rightclicked = ImGui::IsItemClicked(1);
+            state.middleclicked = ImGui::IsItemClicked(2);
+            for (int i = 0; i < state.doubleclicked.size(); i++)
+            {
+                state.doubleclicked[i] = IsItemDoubleClicked(i);
+            }
+        }
+        else
+        {
+            state.leftclicked = state.rightclicked = state.middleclicked = false;
+            state.doubleclicked.fill(false);
         }
         state.visible = ImGui::IsItemVisible();
 
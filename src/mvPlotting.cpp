@@ -1,5 +1,10 @@
 #include "mvPlotting.h"
 #include <utility>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <thread>
 #include "mvCore.h"
 #include "mvContext.h"
 #include "mvItemRegistry.h"
@@ -9,6 +14,7 @@
 #include "mvContainers.h"
 #include "mvTextureItems.h"
 #include "mvItemHandlers.h"
+#include "mvUtilities.h"
 
 static void
 draw_polygon(const mvAreaSeriesConfig& config)
@@ -124,20 +130,29 @@ int BinarySearch(const T* arr, int l, int r, T x) {
 	return -1;
 }
 
+// bucket > 0 marks aggregated candles centered in buckets of that width; the
+// tooltip then picks the bucket under the mouse instead of the rounded time.
+// extents, if given, are fitted instead of walking every candle.
 static void
 PlotCandlestick(const char* label_id, const double* xs, const double* opens,
 	const double* closes, const double* lows, const double* highs, int count,
-	bool tooltip, float width_percent, const ImVec4& bullCol, const ImVec4& bearCol, int time_unit)
+	bool tooltip, float half_width, const ImVec4& bullCol, const ImVec4& bearCol, int time_unit,
+	double bucket = 0.0, const ImPlotLimits* extents = nullptr)
 {
 
 	ImDrawList* draw_list = ImPlot::GetPlotDrawList();
-	// calc real value width
-	float half_width = count > 1 ? ((float)xs[1] - (float)xs[0]) * width_percent : width_percent;
 
 	// custom tool
 	if (ImPlot::IsPlotHovered() && tooltip) {
 		ImPlotPoint mouse = ImPlot::GetPlotMousePos();
-		mouse.x = ImPlot::RoundTime(ImPlotTime::FromDouble(mouse.x), time_unit).ToDouble();
+		if (bucket > 0.0)
+		{
+			const double* first = std::lower_bound(xs, xs + count, mouse.x - bucket * 0.5);
+			if (first != xs + count && *first <= mouse.x + bucket * 0.5)
+				mouse.x = *first;
+		}
+		else
+			mouse.x = ImPlot::RoundTime(ImPlotTime::FromDouble(mouse.x), time_unit).ToDouble();
 		float  tool_l = ImPlot::PlotToPixels(mouse.x - half_width * 1.5, mouse.y).x;
 		float  tool_r = ImPlot::PlotToPixels(mouse.x + half_width * 1.5, mouse.y).x;
 		float  tool_t = ImPlot::GetPlotPos().y;
@@ -199,7 +214,11 @@ PlotCandlestick(const char* label_id, const double* xs, const double* opens,
 		// override legend icon color
 		ImPlot::GetCurrentItem()->Color = ImGui::ColorConvertFloat4ToU32({ 0.25f, 0.25f, 0.25f, 1.0f });
 		// fit data if requested
-		if (ImPlot::FitThisFrame()) {
+		if (ImPlot::FitThisFrame() && extents) {
+			ImPlot::FitPoint(ImPlotPoint(extents->X.Min, extents->Y.Min));
+			ImPlot::FitPoint(ImPlotPoint(extents->X.Max, extents->Y.Max));
+		}
+		else if (ImPlot::FitThisFrame()) {
 			for (int i = 0; i < count; ++i) {
 				ImPlot::FitPoint(ImPlotPoint(xs[i], lows[i]));
 				ImPlot::FitPoint(ImPlotPoint(xs[i], highs[i]));
@@ -262,7 +281,7 @@ DearPyGui::set_data_source(mvAppItem& item, mvUUID dataSource, mvDragLineConfig&
 			"Values types do not match: " + std::to_string(dataSource), &item);
 		return;
 	}
-	outConfig.value = *static_cast<std::shared_ptr<double>*>(srcItem->getValue());
+	outConfig.value = *static_cast<std::shared_ptr<std::atomic<double>>*>(srcItem->getValue());
 }
 
 void
@@ -724,17 +743,21 @@ DearPyGui::draw_drag_line(ImDrawList* drawlist, mvAppItem& item, mvDragLineConfi
 
 	ScopedID id(item.uuid);
 
+	double value = *config.value;
+
 	if (config.vertical)
 	{
-		if (ImPlot::DragLineX(item.config.specifiedLabel.c_str(), config.value.get(), config.show_label, config.color, config.thickness))
+		if (ImPlot::DragLineX(item.config.specifiedLabel.c_str(), &value, config.show_label, config.color, config.thickness))
 		{
+			*config.value = value;
 			mvAddCallbackJob({item.getCallback(true), item, nullptr});
 		}
 	}
 	else
 	{
-		if (ImPlot::DragLineY(item.config.specifiedLabel.c_str(), config.value.get(), config.show_label, config.color, config.thickness))
+		if (ImPlot::DragLineY(item.config.specifiedLabel.c_str(), &value, config.show_label, config.color, config.thickness))
 		{
+			*config.value = value;
 			mvAddCallbackJob({item.getCallback(true), item, nullptr});
 		}
 	}
@@ -833,8 +856,139 @@ DearPyGui::draw_bar_series(ImDrawList* drawlist, mvAppItem& item, const mvBarSer
 	cleanup_local_theming(&item);
 }
 
+// Values shared through a source can change without the series knowing.
+// Marks the series dirty when the version of the source chain moved.
+static void
+check_source_version(mvAppItem& item, u32& sourceVersion, bool& dirty)
+{
+	if (item.config.source == 0)
+		return;
+
+	u32 version = GetSourceVersion(*GContext->itemRegistry, item.config.source);
+	if (version != sourceVersion)
+	{
+		sourceVersion = version;
+		dirty = true;
+	}
+}
+
+// a column keeps its cached extents when the new values only append to the old ones
+static void
+set_series_column(mvBasicSeriesConfig& config, size_t column, std::vector<double>&& values)
+{
+	std::vector<double>& current = (*config.value)[column];
+	mvColumnExtents& extents = config._extents[column];
+	if (extents.scanned > values.size() || extents.scanned > current.size()
+		|| memcmp(current.data(), values.data(), extents.scanned * sizeof(double)) != 0)
+		extents = mvColumnExtents();
+	current = std::move(values);
+	config._generation++;
+}
+
 void
-DearPyGui::draw_line_series(ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config)
+DearPyGui::set_series_values(mvBasicSeriesConfig& config, std::vector<std::vector<double>>&& values)
+{
+	if (values.size() != config.value->size())
+	{
+		*config.value = std::move(values);
+		config._extents.fill(mvColumnExtents());
+		config._generation++;
+		return;
+	}
+
+	for (size_t i = 0; i < values.size(); i++)
+		set_series_column(config, i, std::move(values[i]));
+}
+
+// folds values appended since the last call into the column's extents
+static const mvColumnExtents&
+column_extents(mvBasicSeriesConfig& config, size_t column, bool shared)
+{
+	const std::vector<double>& values = (*config.value)[column];
+	mvColumnExtents& extents = config._extents[column];
+
+	// shared is set when the values changed through a source
+	if (shared || extents.scanned > values.size())
+		extents = mvColumnExtents();
+
+	for (size_t i = extents.scanned; i < values.size(); i++)
+	{
+		const double v = values[i];
+		if (ImNanOrInf(v))
+			continue;
+
+		if (!extents.valid)
+		{
+			extents.min = extents.max = v;
+			extents.valid = true;
+		}
+		else
+		{
+			extents.min = v < extents.min ? v : extents.min;
+			extents.max = v > extents.max ? v : extents.max;
+		}
+
+		if (v > 0.0 && (!extents.positive || v < extents.minPositive))
+		{
+			extents.minPositive = v;
+			extents.positive = true;
+		}
+	}
+	extents.scanned = values.size();
+	return extents;
+}
+
+// ImPlot fits by walking every point in the Plot* call. When the plot fits
+// this frame, the cached extents are fed to the fitter instead and fitting is
+// hidden from the following Plot* call. end_cached_fit restores it.
+// substituted is set when the Plot* call is given other points than the
+// series' values (density bins), which ImPlot must never fit against.
+static bool
+begin_cached_fit(mvAppItem& item, mvBasicSeriesConfig& config, std::initializer_list<size_t> yColumns, bool fitZeroY = false, bool substituted = false)
+{
+	ImPlotContext* context = ImPlot::GetCurrentContext();
+	if (!context->FitThisFrame)
+		return false;
+
+	// new and hidden items are left to ImPlot
+	ImPlotItem* plotItem = ImPlot::GetItem(item.info.internalLabel.c_str());
+	if (plotItem == nullptr && !substituted)
+		return false;
+	if (plotItem != nullptr && !plotItem->Show)
+		return false;
+
+	// values shared through a source are rescanned when the source changed
+	bool shared = false;
+	check_source_version(item, config._sourceVersion, shared);
+	const mvColumnExtents& x = column_extents(config, 0, shared);
+	if (!x.valid)
+		return false;
+
+	// FitPoint skips NaN and (on log axes) non-positive coordinates per axis
+	for (size_t column : yColumns)
+	{
+		const mvColumnExtents& y = column_extents(config, column, shared);
+		ImPlot::FitPoint(ImPlotPoint(x.min, y.valid ? y.min : NAN));
+		ImPlot::FitPoint(ImPlotPoint(x.max, y.valid ? y.max : NAN));
+		if (x.positive || y.positive)
+			ImPlot::FitPoint(ImPlotPoint(x.positive ? x.minPositive : NAN, y.positive ? y.minPositive : NAN));
+	}
+	if (fitZeroY)
+		ImPlot::FitPoint(ImPlotPoint(NAN, 0.0));
+
+	context->FitThisFrame = false;
+	return true;
+}
+
+static void
+end_cached_fit(bool fitting)
+{
+	if (fitting)
+		ImPlot::GetCurrentContext()->FitThisFrame = true;
+}
+
+void
+DearPyGui::draw_line_series(ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -863,7 +1017,9 @@ DearPyGui::draw_line_series(ImDrawList* drawlist, mvAppItem& item, const mvBasic
 		xptr = &(*config.value.get())[0];
 		yptr = &(*config.value.get())[1];
 
+		bool fitting = begin_cached_fit(item, config, { 1 });
 		ImPlot::PlotLine(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+		end_cached_fit(fitting);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -901,8 +1057,130 @@ DearPyGui::draw_line_series(ImDrawList* drawlist, mvAppItem& item, const mvBasic
 	cleanup_local_theming(&item);
 }
 
+// Marks the cells of a grid over the limits in key that hold at least one
+// point. Runs on a worker thread against a snapshot of the series.
+static mvScatterBins
+bin_scatter_points(std::shared_ptr<const std::vector<std::vector<double>>> points, unsigned snapshot, std::array<double, 8> key)
+{
+	mvScatterBins bins;
+	bins.key = key;
+	bins.snapshot = snapshot;
+
+	const bool logX = key[6] != 0.0;
+	const bool logY = key[7] != 0.0;
+	auto to_axis = [](double value, bool log) { return log ? std::log10(value) : value; };
+	auto from_axis = [](double value, bool log) { return log ? std::pow(10.0, value) : value; };
+
+	double xmin = to_axis(key[0], logX);
+	double xmax = to_axis(key[1], logX);
+	double ymin = to_axis(key[2], logY);
+	double ymax = to_axis(key[3], logY);
+	if (!(xmax > xmin) || !(ymax > ymin) || key[4] < 1.0 || key[5] < 1.0)
+		return bins;
+
+	// bin half a view past every edge so panning still shows cells until the next job lands
+	double xpad = (xmax - xmin) * 0.5;
+	double ypad = (ymax - ymin) * 0.5;
+	xmin -= xpad;
+	xmax += xpad;
+	ymin -= ypad;
+	ymax += ypad;
+	const size_t cols = (size_t)key[4] * 2;
+	const size_t rows = (size_t)key[5] * 2;
+	const double xscale = (double)cols / (xmax - xmin);
+	const double yscale = (double)rows / (ymax - ymin);
+
+	const std::vector<double>& xs = (*points)[0];
+	const std::vector<double>& ys = (*points)[1];
+	size_t count = std::min(xs.size(), ys.size());
+	std::vector<u8> occupied(cols * rows, 0);
+	for (size_t i = 0; i < count; i++)
+	{
+		// also rejects NaN and, on log axes, non-positive values
+		double cx = (to_axis(xs[i], logX) - xmin) * xscale;
+		double cy = (to_axis(ys[i], logY) - ymin) * yscale;
+		if (!(cx >= 0.0 && cx < (double)cols && cy >= 0.0 && cy < (double)rows))
+			continue;
+		occupied[(size_t)cy * cols + (size_t)cx] = 1;
+	}
+
+	for (size_t row = 0; row < rows; row++)
+	{
+		for (size_t col = 0; col < cols; col++)
+		{
+			if (!occupied[row * cols + col])
+				continue;
+			bins.xs.push_back(from_axis(xmin + ((double)col + 0.5) / xscale, logX));
+			bins.ys.push_back(from_axis(ymin + ((double)row + 0.5) / yscale, logY));
+		}
+	}
+	return bins;
+}
+
+// Returns the cells to draw in place of the points. A new job is started
+// when the limits, plot size, marker size or data changed; until it lands
+// the previous cells are drawn.
+static const mvScatterBins&
+update_scatter_density(mvBasicSeriesConfig& config, u32 sourceVersion)
+{
+	if (!config._density)
+		config._density = std::make_shared<mvScatterDensity>();
+	mvScatterDensity& density = *config._density;
+
+	// commit a finished job
+	if (density.job.valid() && density.job.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+	{
+		density.bins = density.job.get();
+		density.ready = true;
+	}
+
+	// one cell per marker so neighbouring markers barely overlap
+	ImPlotPlot* plot = ImPlot::GetCurrentContext()->CurrentPlot;
+	ImPlotLimits limits = ImPlot::GetPlotLimits();
+	ImVec2 size = ImPlot::GetPlotSize();
+	double cell = std::max(1.0f, ImPlot::GetStyle().MarkerSize);
+	std::array<double, 8> key = {
+		limits.X.Min, limits.X.Max, limits.Y.Min, limits.Y.Max,
+		std::ceil(size.x / cell), std::ceil(size.y / cell),
+		ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) ? 1.0 : 0.0,
+		ImHasFlag(plot->YAxis[plot->CurrentYAxis].Flags, ImPlotAxisFlags_LogScale) ? 1.0 : 0.0 };
+
+	if (density.job.valid())
+		return density.bins;
+
+	// values shared through a source are caught by the source's version
+	const std::vector<std::vector<double>>& value = *config.value;
+	if (!density.points || density.generation != config._generation || density.sourceVersion != sourceVersion)
+	{
+		density.points = std::make_shared<const std::vector<std::vector<double>>>(
+			std::vector<std::vector<double>>{ value[0], value[1] });
+		density.generation = config._generation;
+		density.sourceVersion = sourceVersion;
+		density.snapshot++;
+	}
+
+	if (density.ready && density.bins.key == key && density.bins.snapshot == density.snapshot)
+		return density.bins;
+
+	// the worker is detached (unlike std::async, the future doesn't block when
+	// the series is deleted), it only holds the snapshot it bins
+	std::packaged_task<mvScatterBins()> task([points = density.points, snapshot = density.snapshot, key]() {
+		return bin_scatter_points(points, snapshot, key);
+		});
+	density.job = task.get_future();
+	std::thread(std::move(task)).detach();
+
+	// nothing to show yet, wait for the first one
+	if (!density.ready)
+	{
+		density.bins = density.job.get();
+		density.ready = true;
+	}
+	return density.bins;
+}
+
 void
-DearPyGui::draw_scatter_series(ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config)
+DearPyGui::draw_scatter_series(ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -931,7 +1209,17 @@ DearPyGui::draw_scatter_series(ImDrawList* drawlist, mvAppItem& item, const mvBa
 		xptr = &(*config.value.get())[0];
 		yptr = &(*config.value.get())[1];
 
-		ImPlot::PlotScatter(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+		bool density = config.densityThreshold > 0 && (int)xptr->size() >= config.densityThreshold;
+		bool fitting = begin_cached_fit(item, config, { 1 }, false, density);
+		if (density)
+		{
+			u32 sourceVersion = item.config.source != 0 ? GetSourceVersion(*GContext->itemRegistry, item.config.source) : 0;
+			const mvScatterBins& bins = update_scatter_density(config, sourceVersion);
+			ImPlot::PlotScatter(item.info.internalLabel.c_str(), bins.xs.data(), bins.ys.data(), (int)bins.xs.size());
+		}
+		else
+			ImPlot::PlotScatter(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+		end_cached_fit(fitting);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -970,7 +1258,7 @@ DearPyGui::draw_scatter_series(ImDrawList* drawlist, mvAppItem& item, const mvBa
 }
 
 void
-DearPyGui::draw_stair_series(ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config)
+DearPyGui::draw_stair_series(ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -999,7 +1287,9 @@ DearPyGui::draw_stair_series(ImDrawList* drawlist, mvAppItem& item, const mvBasi
 		xptr = &(*config.value.get())[0];
 		yptr = &(*config.value.get())[1];
 
+		bool fitting = begin_cached_fit(item, config, { 1 });
 		ImPlot::PlotStairs(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+		end_cached_fit(fitting);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1038,7 +1328,7 @@ DearPyGui::draw_stair_series(ImDrawList* drawlist, mvAppItem& item, const mvBasi
 }
 
 void
-DearPyGui::draw_stem_series(ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config)
+DearPyGui::draw_stem_series(ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1067,7 +1357,9 @@ DearPyGui::draw_stem_series(ImDrawList* drawlist, mvAppItem& item, const mvBasic
 		xptr = &(*config.value.get())[0];
 		yptr = &(*config.value.get())[1];
 
+		bool fitting = begin_cached_fit(item, config, { 1 }, true);
 		ImPlot::PlotStems(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+		end_cached_fit(fitting);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1106,7 +1398,7 @@ DearPyGui::draw_stem_series(ImDrawList* drawlist, mvAppItem& item, const mvBasic
 }
 
 void
-DearPyGui::draw_shade_series(ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config)
+DearPyGui::draw_shade_series(ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1137,8 +1429,10 @@ DearPyGui::draw_shade_series(ImDrawList* drawlist, mvAppItem& item, const mvBasi
 		y1ptr = &(*config.value.get())[1];
 		y2ptr = &(*config.value.get())[2];
 
+		bool fitting = begin_cached_fit(item, config, { 1, 2 });
 		ImPlot::PlotShaded(item.info.internalLabel.c_str(), xptr->data(), y1ptr->data(),
 			y2ptr->data(), (int)xptr->size());
+		end_cached_fit(fitting);
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1308,8 +1602,243 @@ DearPyGui::draw_vline_series(ImDrawList* drawlist, mvAppItem& item, const mvBasi
 	cleanup_local_theming(&item);
 }
 
+// Adds samples [begin, end) to counts. binOf returns a sample's bin or -1 when
+// it falls outside the range. Large ranges are split across worker threads.
+template<typename BinFn>
+static size_t
+bin_samples(size_t begin, size_t end, std::vector<double>& counts, BinFn binOf)
+{
+	const size_t minChunk = 65536;
+	size_t chunks = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), (end - begin) / minChunk);
+	if (chunks < 2)
+	{
+		size_t counted = 0;
+		for (size_t i = begin; i < end; i++)
+		{
+			int b = binOf(i);
+			if (b < 0)
+				continue;
+			counts[b] += 1.0;
+			counted++;
+		}
+		return counted;
+	}
+
+	std::vector<std::vector<double>> partials(chunks, std::vector<double>(counts.size(), 0.0));
+	std::vector<size_t> counted(chunks, 0);
+	std::vector<std::thread> workers;
+	for (size_t i = 0; i < chunks; i++)
+	{
+		workers.emplace_back([&, i]() {
+			const size_t first = begin + (end - begin) * i / chunks;
+			const size_t last = begin + (end - begin) * (i + 1) / chunks;
+			for (size_t j = first; j < last; j++)
+			{
+				int b = binOf(j);
+				if (b < 0)
+					continue;
+				partials[i][b] += 1.0;
+				counted[i]++;
+			}
+			});
+	}
+	for (auto& worker : workers)
+		worker.join();
+
+	size_t total = 0;
+	for (size_t i = 0; i < chunks; i++)
+	{
+		for (size_t b = 0; b < counts.size(); b++)
+			counts[b] += partials[i][b];
+		total += counted[i];
+	}
+	return total;
+}
+
+// same bin count rules as ImPlot (ImPlotBin_Sqrt, _Sturges, _Rice, _Scott)
+static int
+calculate_bins(const double* values, size_t count, int method, const ImPlotRange& range)
+{
+	switch (method)
+	{
+	case ImPlotBin_Sqrt:    return (int)ceil(sqrt((double)count));
+	case ImPlotBin_Sturges: return (int)ceil(1.0 + log2((double)count));
+	case ImPlotBin_Rice:    return (int)ceil(2.0 * cbrt((double)count));
+	case ImPlotBin_Scott:
+	{
+		double mean = 0.0;
+		for (size_t i = 0; i < count; i++)
+			mean += values[i];
+		mean /= (double)count;
+		double variance = 0.0;
+		for (size_t i = 0; i < count; i++)
+			variance += (values[i] - mean) * (values[i] - mean);
+		const double width = 3.49 * sqrt(variance / (double)count) / cbrt((double)count);
+		return width > 0.0 ? ImMax(1, (int)round(range.Size() / width)) : 1;
+	}
+	default: return 1;
+	}
+}
+
+static ImPlotRange
+data_range(const double* values, size_t count)
+{
+	ImPlotRange range(DBL_MAX, -DBL_MAX);
+	for (size_t i = 0; i < count; i++)
+	{
+		range.Min = ImMin(range.Min, values[i]);
+		range.Max = ImMax(range.Max, values[i]);
+	}
+	return range;
+}
+
+// Decides how much of the data must be (re)binned. Returns the first sample
+// to add to the cached counts, zeroing them first when a full rebin is needed.
+static size_t
+prepare_histogram_bins(mvHistogramBins& bins, const std::array<double, 6>& key, size_t count, b8 fixedEdges, b8 streaming, b8 dirty)
+{
+	if (bins.valid && bins.key == key)
+	{
+		// append-only data: only the new samples are binned
+		if (streaming && fixedEdges && count >= bins.binned)
+			return bins.binned;
+		if (!dirty)
+			return count;
+	}
+
+	bins.key = key;
+	bins.valid = false;
+	bins.binned = 0;
+	bins.counted = 0;
+	return 0;
+}
+
+static void
+update_histogram(mvHistogramSeriesConfig& config, const std::vector<double>& xs)
+{
+	mvHistogramBins& bins = config._bins;
+	const size_t count = xs.size();
+	const std::array<double, 6> key = { (double)config.bins, config.min, config.max, 0.0, 0.0, 0.0 };
+	const b8 fixedEdges = config.bins > 0 && !(config.min == 0.0 && config.max == 0.0);
+
+	size_t first = prepare_histogram_bins(bins, key, count, fixedEdges, config.streaming, config.dirty);
+	config.dirty = false;
+
+	if (!bins.valid)
+	{
+		bins.xrange = ImPlotRange(config.min, config.max);
+		if (config.min == 0.0 && config.max == 0.0)
+			bins.xrange = data_range(xs.data(), count);
+		bins.xbins = config.bins < 0 ? calculate_bins(xs.data(), count, config.bins, bins.xrange) : config.bins;
+		bins.counts.assign(bins.xbins, 0.0);
+		bins.centers.resize(bins.xbins);
+		const double width = bins.xrange.Size() / bins.xbins;
+		for (int b = 0; b < bins.xbins; b++)
+			bins.centers[b] = bins.xrange.Min + b * width + width * 0.5;
+		bins.valid = true;
+	}
+	else if (first == count && bins.cumlative == config.cumlative && bins.density == config.density && bins.outliers == config.outliers)
+		return;
+
+	const ImPlotRange range = bins.xrange;
+	const int binCount = bins.xbins;
+	const double width = range.Size() / binCount;
+	bins.counted += bin_samples(first, count, bins.counts, [&](size_t i) {
+		const double v = xs[i];
+		if (!(v >= range.Min && v <= range.Max))
+			return -1;
+		return ImClamp((int)((v - range.Min) / width), 0, binCount - 1);
+		});
+	bins.binned = count;
+
+	// normalize, as ImPlot::PlotHistogram does
+	bins.cumlative = config.cumlative;
+	bins.density = config.density;
+	bins.outliers = config.outliers;
+	bins.heights = bins.counts;
+	const double total = (double)(config.outliers ? count : bins.counted);
+	if (config.cumlative && config.density)
+	{
+		bins.heights[0] /= total;
+		for (int b = 1; b < binCount; b++)
+			bins.heights[b] = bins.heights[b] / total + bins.heights[b - 1];
+	}
+	else if (config.cumlative)
+	{
+		for (int b = 1; b < binCount; b++)
+			bins.heights[b] += bins.heights[b - 1];
+	}
+	else if (config.density)
+	{
+		for (int b = 0; b < binCount; b++)
+			bins.heights[b] /= total * width;
+	}
+}
+
+static void
+update_2dhistogram(mv2dHistogramSeriesConfig& config, const std::vector<double>& xs, const std::vector<double>& ys)
+{
+	mvHistogramBins& bins = config._bins;
+	const size_t count = ImMin(xs.size(), ys.size());
+	const std::array<double, 6> key = { (double)config.xbins, (double)config.ybins, config.xmin, config.xmax, config.ymin, config.ymax };
+	const b8 fixedEdges = config.xbins > 0 && config.ybins > 0
+		&& !(config.xmin == 0.0 && config.xmax == 0.0) && !(config.ymin == 0.0 && config.ymax == 0.0);
+
+	size_t first = prepare_histogram_bins(bins, key, count, fixedEdges, config.streaming, config.dirty);
+	config.dirty = false;
+
+	if (!bins.valid)
+	{
+		bins.xrange = ImPlotRange(config.xmin, config.xmax);
+		bins.yrange = ImPlotRange(config.ymin, config.ymax);
+		if (config.xmin == 0.0 && config.xmax == 0.0)
+			bins.xrange = data_range(xs.data(), count);
+		if (config.ymin == 0.0 && config.ymax == 0.0)
+			bins.yrange = data_range(ys.data(), count);
+		bins.xbins = config.xbins < 0 ? calculate_bins(xs.data(), count, config.xbins, bins.xrange) : config.xbins;
+		bins.ybins = config.ybins < 0 ? calculate_bins(ys.data(), count, config.ybins, bins.yrange) : config.ybins;
+		bins.counts.assign((size_t)bins.xbins * bins.ybins, 0.0);
+		bins.valid = true;
+	}
+	else if (first == count && bins.density == config.density && bins.outliers == config.outliers)
+		return;
+
+	const ImPlotRange xrange = bins.xrange;
+	const ImPlotRange yrange = bins.yrange;
+	const int xbins = bins.xbins;
+	const int ybins = bins.ybins;
+	const double width = xrange.Size() / xbins;
+	const double height = yrange.Size() / ybins;
+
+	// rows are stored top down, as ImPlot::PlotHeatmap expects
+	bins.counted += bin_samples(first, count, bins.counts, [&](size_t i) {
+		const double x = xs[i];
+		const double y = ys[i];
+		if (!(x >= xrange.Min && x <= xrange.Max && y >= yrange.Min && y <= yrange.Max))
+			return -1;
+		const int xb = ImClamp((int)((x - xrange.Min) / width), 0, xbins - 1);
+		const int yb = ImClamp((int)((y - yrange.Min) / height), 0, ybins - 1);
+		return (ybins - 1 - yb) * xbins + xb;
+		});
+	bins.binned = count;
+
+	bins.density = config.density;
+	bins.outliers = config.outliers;
+	bins.heights = bins.counts;
+	bins.maxHeight = 0.0;
+	for (double c : bins.counts)
+		bins.maxHeight = ImMax(bins.maxHeight, c);
+	if (config.density)
+	{
+		const double scale = 1.0 / ((double)(config.outliers ? count : bins.counted) * width * height);
+		for (double& h : bins.heights)
+			h *= scale;
+		bins.maxHeight *= scale;
+	}
+}
+
 void
-DearPyGui::draw_2dhistogram_series(ImDrawList* drawlist, mvAppItem& item, const mv2dHistogramSeriesConfig& config)
+DearPyGui::draw_2dhistogram_series(ImDrawList* drawlist, mvAppItem& item, mv2dHistogramSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1338,8 +1867,15 @@ DearPyGui::draw_2dhistogram_series(ImDrawList* drawlist, mvAppItem& item, const
 		xptr = &(*config.value.get())[0];
 		yptr = &(*config.value.get())[1];
 
-		ImPlot::PlotHistogram2D(item.info.internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(),
-			config.xbins, config.ybins, config.density, ImPlotLimits(config.xmin, config.xmax, config.ymin, config.ymax), config.outliers);
+		// bins are cached and only recomputed when the data or binning changes
+		if (!xptr->empty() && !yptr->empty() && config.xbins != 0 && config.ybins != 0)
+		{
+			check_source_version(item, config._sourceVersion, config.dirty);
+			update_2dhistogram(config, *xptr, *yptr);
+			const mvHistogramBins& bins = config._bins;
+			ImPlot::PlotHeatmap(item.info.internalLabel.c_str(), bins.heights.data(), bins.ybins, bins.xbins, 0.0, bins.maxHeight,
+				nullptr, { bins.xrange.Min, bins.yrange.Min }, { bins.xrange.Max, bins.yrange.Max });
+		}
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1452,8 +1988,183 @@ DearPyGui::draw_error_series(ImDrawList* drawlist, mvAppItem& item, const mvErro
 	cleanup_local_theming(&item);
 }
 
+mvHeatTexture::~mvHeatTexture()
+{
+	if (texture)
+		FreeTexture(texture);
+}
+
+// Colormaps the series into an RGBA8 texture, downsampled to at most one texel
+// per pixel the series covers in the plot. Only the rectangle of cells that
+// changed since the last upload is recolored and re-uploaded.
+static bool
+update_heat_texture(mvHeatSeriesConfig& config, ImVec2 pixelSize)
+{
+	const std::vector<double>& values = (*config.value)[0];
+	const i32 rows = config.rows;
+	const i32 cols = config.cols;
+
+	if (rows < 1 || cols < 1 || values.size() < (size_t)rows * (size_t)cols)
+		return false;
+
+	if (!config._heatTexture)
+		config._heatTexture = std::make_shared<mvHeatTexture>();
+	mvHeatTexture& heat = *config._heatTexture;
+
+	// downsample to the plotted size, steps are powers of two so zooming
+	// only rebuilds the texture when the size halves or doubles
+	const i32 pixelWidth = ImMax((i32)pixelSize.x, 1);
+	const i32 pixelHeight = ImMax((i32)pixelSize.y, 1);
+	i32 colStep = 1;
+	while ((long long)colStep * pixelWidth < cols) colStep *= 2;
+	i32 rowStep = 1;
+	while ((long long)rowStep * pixelHeight < rows) rowStep *= 2;
+	const i32 width = (cols + colStep - 1) / colStep;
+	const i32 height = (rows + rowStep - 1) / rowStep;
+	const size_t count = (size_t)rows * (size_t)cols;
+
+	// replaying input headless there is no renderer, everything but the upload still runs
+	const b8 upload = !GContext->inputRecorder.replaying;
+
+	b8 rebuild = (upload && heat.texture == nullptr) || heat.pixels.empty() || width != heat.width || height != heat.height
+		|| colStep != heat.colStep || rowStep != heat.rowStep || heat.values.size() != count;
+
+	// dirty rectangle, in source cells
+	i32 r0 = rows, r1 = -1, c0 = cols, c1 = -1;
+
+	if (rebuild)
+	{
+		heat.values.assign(values.begin(), values.begin() + count);
+		r0 = 0; r1 = rows - 1; c0 = 0; c1 = cols - 1;
+	}
+	else if (config.dirty)
+	{
+		for (i32 row = 0; row < rows; row++)
+		{
+			const double* src = &values[(size_t)row * cols];
+			double* dst = &heat.values[(size_t)row * cols];
+			if (memcmp(src, dst, cols * sizeof(double)) == 0)
+				continue;
+
+			i32 first = 0;
+			while (first < cols - 1 && src[first] == dst[first]) first++;
+			i32 last = cols - 1;
+			while (last > first && src[last] == dst[last]) last--;
+
+			r0 = ImMin(r0, row); r1 = row;
+			c0 = ImMin(c0, first); c1 = ImMax(c1, last);
+			memcpy(dst, src, cols * sizeof(double));
+		}
+	}
+	config.dirty = false;
+
+	// scale, auto-ranged over the data when min == max
+	double scaleMin = config.scale_min;
+	double scaleMax = config.scale_max;
+	if (scaleMin == scaleMax)
+	{
+		if (r1 < 0)
+		{
+			scaleMin = heat.scale_min;
+			scaleMax = heat.scale_max;
+		}
+		else
+		{
+			scaleMin = DBL_MAX;
+			scaleMax = -DBL_MAX;
+			for (double v : heat.values)
+			{
+				scaleMin = ImMin(scaleMin, v);
+				scaleMax = ImMax(scaleMax, v);
+			}
+		}
+	}
+
+	// lookup table, rebuilt only when the colormap changes
+	const ImPlotColormap colormap = ImPlot::GetStyle().Colormap;
+	b8 recolor = false;
+	if (colormap != heat.colormap)
+	{
+		for (i32 i = 0; i < 256; i++)
+			heat.lut[i] = ImGui::ColorConvertFloat4ToU32(ImPlot::SampleColormap((f32)i / 255.0f, colormap));
+		heat.colormap = colormap;
+		recolor = true;
+	}
+
+	if (scaleMin != heat.scale_min || scaleMax != heat.scale_max)
+	{
+		heat.scale_min = scaleMin;
+		heat.scale_max = scaleMax;
+		recolor = true;
+	}
+
+	if (recolor)
+	{
+		r0 = 0; r1 = rows - 1; c0 = 0; c1 = cols - 1;
+	}
+
+	if (r1 < 0)
+		return true;
+
+	// recolor the dirty texels
+	const i32 tx0 = c0 / colStep, tx1 = c1 / colStep;
+	const i32 ty0 = r0 / rowStep, ty1 = r1 / rowStep;
+	const double scale = scaleMax > scaleMin ? 255.0 / (scaleMax - scaleMin) : 0.0;
+
+	heat.pixels.resize((size_t)width * height);
+	for (i32 ty = ty0; ty <= ty1; ty++)
+	{
+		const i32 rowEnd = ImMin((ty + 1) * rowStep, rows);
+		for (i32 tx = tx0; tx <= tx1; tx++)
+		{
+			// mean of the cells covered by the texel
+			const i32 colEnd = ImMin((tx + 1) * colStep, cols);
+			double sum = 0.0;
+			for (i32 row = ty * rowStep; row < rowEnd; row++)
+				for (i32 col = tx * colStep; col < colEnd; col++)
+					sum += heat.values[(size_t)row * cols + col];
+			const double mean = sum / ((rowEnd - ty * rowStep) * (colEnd - tx * colStep));
+
+			double t = (mean - scaleMin) * scale;
+			if (!(t > 0.0)) t = 0.0;
+			if (t > 255.0) t = 255.0;
+			heat.pixels[(size_t)ty * width + tx] = heat.lut[(i32)(t + 0.5)];
+		}
+	}
+
+	// upload
+	if (rebuild)
+	{
+		if (heat.texture)
+			FreeTexture(heat.texture);
+		heat.texture = upload ? LoadTextureFromArrayRGBA8(width, height, (const u8*)heat.pixels.data()) : nullptr;
+		heat.width = width;
+		heat.height = height;
+		heat.colStep = colStep;
+		heat.rowStep = rowStep;
+	}
+	else if (!upload)
+		return true;
+	else if (tx0 == 0 && tx1 == width - 1)
+	{
+		// whole rows are contiguous already
+		UpdateTextureRegion(heat.texture, 0, ty0, width, ty1 - ty0 + 1, (const u8*)&heat.pixels[(size_t)ty0 * width]);
+	}
+	else
+	{
+		const i32 regionWidth = tx1 - tx0 + 1;
+		const i32 regionHeight = ty1 - ty0 + 1;
+		heat.region.resize((size_t)regionWidth * regionHeight);
+		for (i32 ty = 0; ty < regionHeight; ty++)
+			memcpy(&heat.region[(size_t)ty * regionWidth], &heat.pixels[(size_t)(ty0 + ty) * width + tx0], regionWidth * sizeof(u32));
+		UpdateTextureRegion(heat.texture, tx0, ty0, regionWidth, regionHeight, (const u8*)heat.region.data());
+	}
+
+	return true;
+}
+
 void
-DearPyGui::draw_heat_series(ImDrawList* drawlist, mvAppItem& item, const mvHeatSeriesConfig& config)
+DearPyGui::draw_heat_series(ImDrawList* drawlist, mvAppItem& item, mvHeatSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1480,9 +2191,20 @@ DearPyGui::draw_heat_series(ImDrawList* drawlist, mvAppItem& item, const mvHeatS
 
 		xptr = &(*config.value.get())[0];
 
-
-		ImPlot::PlotHeatmap(item.info.internalLabel.c_str(), xptr->data(), config.rows, config.cols, config.scale_min, config.scale_max,
-			config.format.c_str(), { config.bounds_min.x, config.bounds_min.y }, { config.bounds_max.x, config.bounds_max.y });
+		if (config.texture)
+		{
+			check_source_version(item, config._sourceVersion, config.dirty);
+
+			// one textured quad instead of a rect (and label) per cell
+			ImVec2 p0 = ImPlot::PlotToPixels(config.bounds_min);
+			ImVec2 p1 = ImPlot::PlotToPixels(config.bounds_max);
+			if (update_heat_texture(config, ImVec2(fabsf(p1.x - p0.x), fabsf(p1.y - p0.y))))
+				ImPlot::PlotImage(item.info.internalLabel.c_str(), config._heatTexture->texture,
+					{ config.bounds_min.x, config.bounds_min.y }, { config.bounds_max.x, config.bounds_max.y });
+		}
+		else
+			ImPlot::PlotHeatmap(item.info.internalLabel.c_str(), xptr->data(), config.rows, config.cols, config.scale_min, config.scale_max,
+				config.format.c_str(), { config.bounds_min.x, config.bounds_min.y }, { config.bounds_max.x, config.bounds_max.y });
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1521,7 +2243,7 @@ DearPyGui::draw_heat_series(ImDrawList* drawlist, mvAppItem& item, const mvHeatS
 }
 
 void
-DearPyGui::draw_histogram_series(ImDrawList* drawlist, mvAppItem& item, const mvHistogramSeriesConfig& config)
+DearPyGui::draw_histogram_series(ImDrawList* drawlist, mvAppItem& item, mvHistogramSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1548,8 +2270,15 @@ DearPyGui::draw_histogram_series(ImDrawList* drawlist, mvAppItem& item, const mv
 
 		xptr = &(*config.value.get())[0];
 
-		ImPlot::PlotHistogram(item.info.internalLabel.c_str(), xptr->data(), (int)xptr->size(), config.bins,
-			config.cumlative, config.density, ImPlotRange(config.min, config.max), config.outliers, (double)config.barScale);
+		// bins are cached and only recomputed when the data or binning changes
+		if (!xptr->empty() && config.bins != 0)
+		{
+			check_source_version(item, config._sourceVersion, config.dirty);
+			update_histogram(config, *xptr);
+			const mvHistogramBins& bins = config._bins;
+			ImPlot::PlotBars(item.info.internalLabel.c_str(), bins.centers.data(), bins.heights.data(), bins.xbins,
+				(double)config.barScale * bins.xrange.Size() / bins.xbins);
+		}
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -1877,8 +2606,169 @@ DearPyGui::draw_area_series(ImDrawList* drawlist, mvAppItem& item, const mvAreaS
 	cleanup_local_theming(&item);
 }
 
+// Builds the aggregation pyramid. Buckets are aligned to the first date and
+// level k holds buckets of 2^k raw candle spacings, merged pairwise from level
+// k-1 so the full series is only walked once per data change.
+static void
+update_candle_levels(mvCandleSeriesConfig& config)
+{
+	const std::vector<std::vector<double>>& value = *config.value;
+	size_t count = value[0].size();
+	for (size_t i = 1; i < 5; i++)
+		count = std::min(count, value[i].size());
+
+	const double* xs = value[0].data();
+	const double* opens = value[1].data();
+	const double* closes = value[2].data();
+	const double* lows = value[3].data();
+	const double* highs = value[4].data();
+
+	config._count = count;
+	config._levels.clear();
+	config._extents = ImPlotLimits();
+
+	// median of the positive gaps, so gaps in the dates (weekends,
+	// holidays) don't widen the buckets the way the mean would
+	config._spacing = 0.0;
+	std::vector<double> gaps;
+	gaps.reserve(count > 1 ? count - 1 : 0);
+	for (size_t i = 1; i < count; i++)
+	{
+		if (xs[i] > xs[i - 1])
+			gaps.push_back(xs[i] - xs[i - 1]);
+	}
+	if (!gaps.empty())
+	{
+		std::nth_element(gaps.begin(), gaps.begin() + gaps.size() / 2, gaps.end());
+		config._spacing = gaps[gaps.size() / 2];
+	}
+
+	if (count == 0)
+		return;
+
+	config._extents.X = ImPlotRange(xs[0], xs[count - 1]);
+	config._extents.Y = ImPlotRange(lows[0], highs[0]);
+	for (size_t i = 1; i < count; i++)
+	{
+		config._extents.Y.Min = std::min(config._extents.Y.Min, lows[i]);
+		config._extents.Y.Max = std::max(config._extents.Y.Max, highs[i]);
+	}
+
+	if (config._spacing <= 0.0)
+		return;
+
+	// bucket index of every candle in the level below
+	std::vector<long long> ids(count);
+	for (size_t i = 0; i < count; i++)
+		ids[i] = (long long)std::floor((xs[i] - xs[0]) / config._spacing + 0.5);
+
+	// levels are read from while the next one is built, keep them in place
+	config._levels.reserve(64);
+	const double x0 = xs[0];
+	double bucket = config._spacing;
+	for (int shift = 1; shift < 64 && count > 2; shift++)
+	{
+		bucket *= 2.0;
+		mvCandleLevel level;
+		level.bucket = bucket;
+
+		std::vector<long long> levelIds;
+		for (size_t i = 0; i < count; i++)
+		{
+			long long id = ids[i] >> 1;
+			if (levelIds.empty() || levelIds.back() != id)
+			{
+				levelIds.push_back(id);
+				level.dates.push_back(x0 + (double)id * bucket + (bucket - config._spacing) * 0.5);
+				level.opens.push_back(opens[i]);
+				level.closes.push_back(closes[i]);
+				level.lows.push_back(lows[i]);
+				level.highs.push_back(highs[i]);
+				continue;
+			}
+			level.closes.back() = closes[i];
+			level.lows.back() = std::min(level.lows.back(), lows[i]);
+			level.highs.back() = std::max(level.highs.back(), highs[i]);
+		}
+
+		// nothing merged, the data is too sparse for this bucket width
+		if (level.dates.size() == count)
+		{
+			ids = std::move(levelIds);
+			continue;
+		}
+
+		config._levels.push_back(std::move(level));
+		const mvCandleLevel& last = config._levels.back();
+		ids = std::move(levelIds);
+		count = last.dates.size();
+		opens = last.opens.data();
+		closes = last.closes.data();
+		lows = last.lows.data();
+		highs = last.highs.data();
+	}
+}
+
+// Draws the coarsest-needed level of the pyramid so candle bodies stay at
+// least min_candle_width pixels wide, culled to the visible x range.
+static void
+draw_aggregated_candles(mvAppItem& item, mvCandleSeriesConfig& config)
+{
+	// shared values are rebuilt only when the source chain reports a change
+	check_source_version(item, config._sourceVersion, config.dirty);
+
+	if (config.dirty)
+	{
+		update_candle_levels(config);
+		config.dirty = false;
+	}
+
+	const std::vector<std::vector<double>>& value = *config.value;
+	const double* xs = value[0].data();
+	const double* opens = value[1].data();
+	const double* closes = value[2].data();
+	const double* lows = value[3].data();
+	const double* highs = value[4].data();
+	size_t count = config._count;
+	double bucket = config._spacing;
+
+	ImPlotLimits limits = ImPlot::GetPlotLimits();
+	double pixelsPerUnit = limits.X.Size() > 0.0 ? ImPlot::GetPlotSize().x / limits.X.Size() : 0.0;
+	double weight = (double)config.weight;
+	if (pixelsPerUnit > 0.0 && 2.0 * bucket * weight * pixelsPerUnit < config.minCandleWidth)
+	{
+		for (const mvCandleLevel& level : config._levels)
+		{
+			xs = level.dates.data();
+			opens = level.opens.data();
+			closes = level.closes.data();
+			lows = level.lows.data();
+			highs = level.highs.data();
+			count = level.dates.size();
+			bucket = level.bucket;
+			if (2.0 * bucket * weight * pixelsPerUnit >= config.minCandleWidth)
+				break;
+		}
+	}
+
+	// limits are still last frame's while fitting, so keep everything then
+	size_t first = 0;
+	size_t last = count;
+	if (!ImPlot::FitThisFrame())
+	{
+		first = std::lower_bound(xs, xs + count, limits.X.Min - bucket) - xs;
+		last = std::upper_bound(xs + first, xs + count, limits.X.Max + bucket) - xs;
+	}
+
+	bool aggregated = bucket != config._spacing;
+	float half_width = config._spacing > 0.0 ? (float)(bucket * weight) : config.weight;
+	PlotCandlestick(item.info.internalLabel.c_str(), xs + first, opens + first, closes + first,
+		lows + first, highs + first, (int)(last - first), config.tooltip, half_width, config.bullColor,
+		config.bearColor, config.timeunit, aggregated ? bucket : 0.0, &config._extents);
+}
+
 void
-DearPyGui::draw_candle_series(ImDrawList* drawlist, mvAppItem& item, const mvCandleSeriesConfig& config)
+DearPyGui::draw_candle_series(ImDrawList* drawlist, mvAppItem& item, mvCandleSeriesConfig& config)
 {
 	//-----------------------------------------------------------------------------
 	// pre draw
@@ -1913,9 +2803,16 @@ DearPyGui::draw_candle_series(ImDrawList* drawlist, mvAppItem& item, const mvCan
 		lowptr = &(*config.value.get())[3];
 		highptr = &(*config.value.get())[4];
 
-		PlotCandlestick(item.info.internalLabel.c_str(), datesptr->data(), openptr->data(), closeptr->data(),
-			lowptr->data(), highptr->data(), (int)datesptr->size(), config.tooltip, config.weight, config.bullColor,
-			config.bearColor, config.timeunit);
+		if (config.minCandleWidth > 0.0f)
+			draw_aggregated_candles(item, config);
+		else
+		{
+			int count = (int)datesptr->size();
+			float half_width = count > 1 ? ((float)(*datesptr)[1] - (float)(*datesptr)[0]) * config.weight : config.weight;
+			PlotCandlestick(item.info.internalLabel.c_str(), datesptr->data(), openptr->data(), closeptr->data(),
+				lowptr->data(), highptr->data(), count, config.tooltip, half_width, config.bullColor,
+				config.bearColor, config.timeunit);
+		}
 
 		// Begin a popup for a legend entry.
 		if (ImPlot::BeginLegendPopup(item.info.internalLabel.c_str(), 1))
@@ -2464,15 +3361,17 @@ DearPyGui::set_configuration(PyObject* inDict, mvBasicSeriesConfig& outConfig)
 		return;
 
 	bool valueChanged = false;
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { valueChanged = true; (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { valueChanged = true; (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y1")) { valueChanged = true; (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "y2")) { valueChanged = true; (*outConfig.value)[2] = ToDoubleVect(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { valueChanged = true; set_series_column(outConfig, 0, ToDoubleVect(item)); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { valueChanged = true; set_series_column(outConfig, 1, ToDoubleVect(item)); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "y1")) { valueChanged = true; set_series_column(outConfig, 1, ToDoubleVect(item)); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "y2")) { valueChanged = true; set_series_column(outConfig, 2, ToDoubleVect(item)); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "density_threshold")) outConfig.densityThreshold = ToInt(item);
 
 	if (valueChanged && outConfig.type == mvAppItemType::mvShadeSeries)
 	{
 		if ((*outConfig.value)[1].size() != (*outConfig.value)[2].size())
 		{
+			outConfig._extents[2] = mvColumnExtents();
 			(*outConfig.value)[2].clear();
 			for (size_t i = 0; i < (*outConfig.value)[1].size(); i++)
 				(*outConfig.value)[2].push_back(0.0);
@@ -2487,7 +3386,8 @@ DearPyGui::set_configuration(PyObject* inDict, mv2dHistogramSeriesConfig& outCon
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); outConfig.dirty = true; }
+	if (PyObject* item = PyDict_GetItemString(inDict, "y")) { (*outConfig.value)[1] = ToDoubleVect(item); outConfig.dirty = true; }
 	if (PyObject* item = PyDict_GetItemString(inDict, "xbins")) { outConfig.xbins = ToInt(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "ybins")) { outConfig.ybins = ToInt(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "xmin_range")) { outConfig.xmin = ToDouble(item); }
@@ -2496,6 +3396,7 @@ DearPyGui::set_configuration(PyObject* inDict, mv2dHistogramSeriesConfig& outCon
 	if (PyObject* item = PyDict_GetItemString(inDict, "ymax_range")) { outConfig.ymax = ToDouble(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "density")) { outConfig.density = ToBool(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "outliers")) { outConfig.outliers = ToBool(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "streaming")) { outConfig.streaming = ToBool(item); }
 }
 
 void
@@ -2524,12 +3425,14 @@ DearPyGui::set_configuration(PyObject* inDict, mvHeatSeriesConfig& outConfig)
 	if (PyObject* item = PyDict_GetItemString(inDict, "bounds_max")) outConfig.bounds_max = ToPoint(item);
 	if (PyObject* item = PyDict_GetItemString(inDict, "scale_min")) outConfig.scale_min = ToDouble(item);
 	if (PyObject* item = PyDict_GetItemString(inDict, "scale_max")) outConfig.scale_max = ToDouble(item);
+	if (PyObject* item = PyDict_GetItemString(inDict, "texture")) outConfig.texture = ToBool(item);
 
 	bool valueChanged = false;
 	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { valueChanged = true; (*outConfig.value)[0] = ToDoubleVect(item); }
 
 	if (valueChanged)
 	{
+		outConfig.dirty = true;
 		(*outConfig.value)[1].push_back(outConfig.bounds_min.y);
 		(*outConfig.value)[1].push_back(outConfig.bounds_max.y);
 	}
@@ -2541,7 +3444,7 @@ DearPyGui::set_configuration(PyObject* inDict, mvHistogramSeriesConfig& outConfi
 	if (inDict == nullptr)
 		return;
 
-	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "x")) { (*outConfig.value)[0] = ToDoubleVect(item); outConfig.dirty = true; }
 	if (PyObject* item = PyDict_GetItemString(inDict, "bins")) { outConfig.bins = ToInt(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "bar_scale")) { outConfig.barScale = ToFloat(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "min_range")) { outConfig.min = ToDouble(item); }
@@ -2549,6 +3452,7 @@ DearPyGui::set_configuration(PyObject* inDict, mvHistogramSeriesConfig& outConfi
 	if (PyObject* item = PyDict_GetItemString(inDict, "cumlative")) { outConfig.cumlative = ToBool(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "density")) { outConfig.density = ToBool(item); }
 	if (PyObject* item = PyDict_GetItemString(inDict, "outliers")) { outConfig.outliers = ToBool(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "streaming")) { outConfig.streaming = ToBool(item); }
 }
 
 void
@@ -2652,12 +3556,13 @@ DearPyGui::set_configuration(PyObject* inDict, mvCandleSeriesConfig& outConfig)
 	if (PyObject* item = PyDict_GetItemString(inDict, "bear_color")) outConfig.bearColor = ToColor(item);
 	if (PyObject* item = PyDict_GetItemString(inDict, "weight")) outConfig.weight = ToFloat(item);
 	if (PyObject* item = PyDict_GetItemString(inDict, "tooltip")) outConfig.tooltip = ToBool(item);
-	if (PyObject* item = PyDict_GetItemString(inDict, "dates")) { (*outConfig.value)[0] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "opens")) { (*outConfig.value)[1] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "closes")) { (*outConfig.value)[2] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "lows")) { (*outConfig.value)[3] = ToDoubleVect(item); }
-	if (PyObject* item = PyDict_GetItemString(inDict, "highs")) { (*outConfig.value)[4] = ToDoubleVect(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "dates")) { (*outConfig.value)[0] = ToDoubleVect(item); outConfig.dirty = true; }
+	if (PyObject* item = PyDict_GetItemString(inDict, "opens")) { (*outConfig.value)[1] = ToDoubleVect(item); outConfig.dirty = true; }
+	if (PyObject* item = PyDict_GetItemString(inDict, "closes")) { (*outConfig.value)[2] = ToDoubleVect(item); outConfig.dirty = true; }
+	if (PyObject* item = PyDict_GetItemString(inDict, "lows")) { (*outConfig.value)[3] = ToDoubleVect(item); outConfig.dirty = true; }
+	if (PyObject* item = PyDict_GetItemString(inDict, "highs")) { (*outConfig.value)[4] = ToDoubleVect(item); outConfig.dirty = true; }
 	if (PyObject* item = PyDict_GetItemString(inDict, "time_unit")) { outConfig.timeunit = ToUUID(item); }
+	if (PyObject* item = PyDict_GetItemString(inDict, "min_candle_width")) { outConfig.minCandleWidth = ToFloat(item); }
 }
 
 void
@@ -2863,6 +3768,9 @@ DearPyGui::fill_configuration_dict(const mvBasicSeriesConfig& inConfig, PyObject
 {
 	if (outDict == nullptr)
 		return;
+
+	if (inConfig.type == mvAppItemType::mvScatterSeries)
+		PyDict_SetItemString(outDict, "density_threshold", mvPyObject(ToPyInt(inConfig.densityThreshold)));
 }
 
 void
@@ -2879,6 +3787,7 @@ DearPyGui::fill_configuration_dict(const mv2dHistogramSeriesConfig& inConfig, Py
 	PyDict_SetItemString(outDict, "ymax_range", mvPyObject(ToPyBool(inConfig.ymax)));
 	PyDict_SetItemString(outDict, "density", mvPyObject(ToPyBool(inConfig.density)));
 	PyDict_SetItemString(outDict, "outliers", mvPyObject(ToPyBool(inConfig.outliers)));
+	PyDict_SetItemString(outDict, "streaming", mvPyObject(ToPyBool(inConfig.streaming)));
 }
 
 void
@@ -2903,6 +3812,7 @@ DearPyGui::fill_configuration_dict(const mvHeatSeriesConfig& inConfig, PyObject*
 	PyDict_SetItemString(outDict, "bounds_max", mvPyObject(ToPyPair(inConfig.bounds_max.x, inConfig.bounds_max.y)));
 	PyDict_SetItemString(outDict, "scale_min", mvPyObject(ToPyDouble(inConfig.scale_min)));
 	PyDict_SetItemString(outDict, "scale_max", mvPyObject(ToPyDouble(inConfig.scale_max)));
+	PyDict_SetItemString(outDict, "texture", mvPyObject(ToPyBool(inConfig.texture)));
 }
 
 void
@@ -2918,6 +3828,7 @@ DearPyGui::fill_configuration_dict(const mvHistogramSeriesConfig& inConfig, PyOb
 	PyDict_SetItemString(outDict, "cumlative", mvPyObject(ToPyBool(inConfig.cumlative)));
 	PyDict_SetItemString(outDict, "density", mvPyObject(ToPyBool(inConfig.density)));
 	PyDict_SetItemString(outDict, "outliers", mvPyObject(ToPyBool(inConfig.outliers)));
+	PyDict_SetItemString(outDict, "streaming", mvPyObject(ToPyBool(inConfig.streaming)));
 }
 
 void
@@ -2977,6 +3888,7 @@ DearPyGui::fill_configuration_dict(const mvCandleSeriesConfig& inConfig, PyObjec
 	PyDict_SetItemString(outDict, "weight",     mvPyObject(ToPyFloat(inConfig.weight)));
 	PyDict_SetItemString(outDict, "tooltip",    mvPyObject(ToPyBool(inConfig.tooltip)));
 	PyDict_SetItemString(outDict, "time_unit",  mvPyObject(ToPyLong(inConfig.timeunit)));
+	PyDict_SetItemString(outDict, "min_candle_width", mvPyObject(ToPyFloat(inConfig.minCandleWidth)));
 }
 
 void
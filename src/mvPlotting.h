@@ -2,6 +2,7 @@
 
 #include "mvItemRegistry.h"
 #include <array>
+#include <future>
 
 struct mvPlotConfig;
 struct mvPlotAxisConfig;
@@ -91,6 +92,9 @@ namespace DearPyGui
     void set_data_source(mvAppItem& item, mvUUID dataSource, mvDragPointConfig& outConfig);
     void set_data_source(mvAppItem& item, mvUUID dataSource, std::shared_ptr<std::vector<std::vector<double>>>& outValue);
 
+    // replaces series values, keeping cached extents of columns that were only appended to
+    void set_series_values(mvBasicSeriesConfig& config, std::vector<std::vector<double>>&& values);
+
     // draw commands
     void draw_plot              (ImDrawList* drawlist, mvAppItem& item, mvPlotConfig& config);
     void draw_plot_axis         (ImDrawList* drawlist, mvAppItem& item, mvPlotAxisConfig& config);
@@ -99,22 +103,22 @@ namespace DearPyGui
     void draw_drag_line         (ImDrawList* drawlist, mvAppItem& item, mvDragLineConfig& config);
     void draw_drag_point        (ImDrawList* drawlist, mvAppItem& item, mvDragPointConfig& config);
     void draw_bar_series        (ImDrawList* drawlist, mvAppItem& item, const mvBarSeriesConfig& config);
-    void draw_line_series       (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
-    void draw_scatter_series    (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
-    void draw_stair_series      (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
-    void draw_stem_series       (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
-    void draw_shade_series      (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
+    void draw_line_series       (ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config);
+    void draw_scatter_series    (ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config);
+    void draw_stair_series      (ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config);
+    void draw_stem_series       (ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config);
+    void draw_shade_series      (ImDrawList* drawlist, mvAppItem& item, mvBasicSeriesConfig& config);
     void draw_hline_series      (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
     void draw_vline_series      (ImDrawList* drawlist, mvAppItem& item, const mvBasicSeriesConfig& config);
-    void draw_2dhistogram_series(ImDrawList* drawlist, mvAppItem& item, const mv2dHistogramSeriesConfig& config);
+    void draw_2dhistogram_series(ImDrawList* drawlist, mvAppItem& item, mv2dHistogramSeriesConfig& config);
     void draw_error_series      (ImDrawList* drawlist, mvAppItem& item, const mvErrorSeriesConfig& config);
-    void draw_heat_series       (ImDrawList* drawlist, mvAppItem& item, const mvHeatSeriesConfig& config);
-    void draw_histogram_series  (ImDrawList* drawlist, mvAppItem& item, const mvHistogramSeriesConfig& config);
+    void draw_heat_series       (ImDrawList* drawlist, mvAppItem& item, mvHeatSeriesConfig& config);
+    void draw_histogram_series  (ImDrawList* drawlist, mvAppItem& item, mvHistogramSeriesConfig& config);
     void draw_pie_series        (ImDrawList* drawlist, mvAppItem& item, const mvPieSeriesConfig& config);
     void draw_label_series      (ImDrawList* drawlist, mvAppItem& item, const mvLabelSeriesConfig& config);
     void draw_image_series      (ImDrawList* drawlist, mvAppItem& item, mvImageSeriesConfig& config);
     void draw_area_series       (ImDrawList* drawlist, mvAppItem& item, const mvAreaSeriesConfig& config);
-    void draw_candle_series     (ImDrawList* drawlist, mvAppItem& item, const mvCandleSeriesConfig& config);
+    void draw_candle_series     (ImDrawList* drawlist, mvAppItem& item, mvCandleSeriesConfig& config);
     void draw_custom_series     (ImDrawList* drawlist, mvAppItem& item, mvCustomSeriesConfig& config);
     void draw_plot_annotation   (ImDrawList* drawlist, mvAppItem& item, mvAnnotationConfig& config);
 }
@@ -123,15 +127,52 @@ namespace DearPyGui
 // Structs
 //-----------------------------------------------------------------------------
 
+// min/max of a series column, extended as values are appended
+struct mvColumnExtents
+{
+    size_t scanned = 0;          // values folded in so far
+    bool   valid = false;        // any finite value
+    bool   positive = false;     // any value > 0 (log axes)
+    double min = 0.0;
+    double max = 0.0;
+    double minPositive = 0.0;
+};
+
+// occupied cells of a screen-resolution grid over the plot limits
+struct mvScatterBins
+{
+    std::array<double, 8> key = {}; // limits, grid size and log axes the cells were binned for
+    unsigned              snapshot = 0;
+    std::vector<double>   xs;       // cell centers
+    std::vector<double>   ys;
+};
+
+// density mode of scatter series, binning runs on a worker thread
+struct mvScatterDensity
+{
+    std::shared_ptr<const std::vector<std::vector<double>>> points; // x/y snapshot read by the job
+    unsigned                   generation = 0; // series generation of the snapshot
+    u32                        sourceVersion = 0; // source version of the snapshot
+    unsigned                   snapshot = 0;
+    bool                       ready = false;
+    mvScatterBins              bins;
+    std::future<mvScatterBins> job;
+};
+
 struct mvBasicSeriesConfig
 {
     mvAppItemType type = mvAppItemType::All;
+    int           densityThreshold = 0; // scatter only, 0 disables density mode
     std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{} });
+    std::array<mvColumnExtents, 5>    _extents; // fed to ImPlot's fitter instead of every point
+    unsigned                          _generation = 0; // bumped on every value change
+    u32                               _sourceVersion = 0; // source version the extents were scanned at
+    std::shared_ptr<mvScatterDensity> _density;
 };
 
 struct mvBarSeriesConfig
@@ -165,7 +206,7 @@ struct mvDragPointConfig
 
 struct mvDragLineConfig
 {
-    std::shared_ptr<double> value = std::make_shared<double>(0.0);
+    std::shared_ptr<std::atomic<double>> value = std::make_shared<std::atomic<double>>(0.0);
     float         disabled_value = 0.0;
     bool          show_label = true;
     mvColor       color = mvColor(0.0f, 0.0f, 0.0f, -1.0f);
@@ -173,6 +214,26 @@ struct mvDragLineConfig
     bool          vertical = true;
 };
 
+// bin counts of a histogram series, kept between frames
+struct mvHistogramBins
+{
+    std::array<double, 6> key{};        // requested bins and ranges the counts were built for
+    bool                  valid = false;
+    bool                  cumlative = false;
+    bool                  density = false;
+    bool                  outliers = true;
+    int                   xbins = 0;
+    int                   ybins = 0;
+    ImPlotRange           xrange;
+    ImPlotRange           yrange;
+    size_t                binned = 0;  // samples counted so far
+    size_t                counted = 0; // samples that fell inside the range
+    std::vector<double>   counts;
+    std::vector<double>   centers;     // 1d only
+    std::vector<double>   heights;     // normalized counts, as drawn
+    double                maxHeight = 0.0;
+};
+
 struct mv2dHistogramSeriesConfig
 {
     int    xbins = -1;
@@ -183,6 +244,10 @@ struct mv2dHistogramSeriesConfig
     double xmax = 1.0;
     double ymin = 0.0;
     double ymax = 1.0;
+    bool   streaming = false; // samples are only appended, new ones are added to the cached bins
+    bool   dirty = true;      // values changed since the bins were computed
+    u32    _sourceVersion = 0; // source version the bins were computed from
+    mvHistogramBins _bins;
     std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
@@ -202,6 +267,25 @@ struct mvErrorSeriesConfig
         std::vector<double>{} });
 };
 
+// colormapped RGBA8 image of a heat series (texture mode)
+struct mvHeatTexture
+{
+    void*                texture = nullptr;
+    i32                  width = 0;    // texels, after downsampling
+    i32                  height = 0;
+    i32                  colStep = 1;  // source cells per texel
+    i32                  rowStep = 1;
+    ImPlotColormap       colormap = -1;
+    double               scale_min = 0.0;
+    double               scale_max = 0.0;
+    std::array<u32, 256> lut{};
+    std::vector<double>  values;       // source values at the last upload
+    std::vector<u32>     pixels;       // width * height
+    std::vector<u32>     region;       // scratch for partial uploads
+
+    ~mvHeatTexture();
+};
+
 struct mvHeatSeriesConfig
 {
     int         rows = 1;
@@ -211,6 +295,10 @@ struct mvHeatSeriesConfig
     std::string format = "%0.1f";
     ImPlotPoint bounds_min = { 0.0, 0.0 };
     ImPlotPoint bounds_max = { 1.0, 1.0 };
+    bool        texture = false;
+    bool        dirty = true; // values changed since the last texture upload
+    u32         _sourceVersion = 0; // source version at the last upload
+    std::shared_ptr<mvHeatTexture> _heatTexture = nullptr;
     std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
@@ -228,6 +316,10 @@ struct mvHistogramSeriesConfig
     float  barScale = 1.0f;
     double min = 0.0;
     double max = 1.0;
+    bool   streaming = false; // samples are only appended, new ones are added to the cached bins
+    bool   dirty = true;      // values changed since the bins were computed
+    u32    _sourceVersion = 0; // source version the bins were computed from
+    mvHistogramBins _bins;
     std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
@@ -300,6 +392,17 @@ struct mvAreaSeriesConfig
         std::vector<double>{} });
 };
 
+// candles aggregated into time buckets (open first, high max, low min, close last)
+struct mvCandleLevel
+{
+    double              bucket = 0.0; // bucket width in x units
+    std::vector<double> dates;        // bucket centers
+    std::vector<double> opens;
+    std::vector<double> closes;
+    std::vector<double> lows;
+    std::vector<double> highs;
+};
+
 struct mvCandleSeriesConfig
 {
     float   weight = 0.25f;
@@ -307,12 +410,21 @@ struct mvCandleSeriesConfig
     int     timeunit = ImPlotTimeUnit_Day;
     mvColor bullColor = { 0, 255, 113, 255 };
     mvColor bearColor = { 218, 13, 79, 255 };
+    float   minCandleWidth = 0.0f; // pixels, 0 disables aggregation
     std::shared_ptr<std::vector<std::vector<double>>> value = std::make_shared<std::vector<std::vector<double>>>(
         std::vector<std::vector<double>>{ std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{},
         std::vector<double>{} });
+
+    // aggregation pyramid, each level doubles the bucket width of the previous one
+    bool                       dirty = true;
+    size_t                     _count = 0;
+    double                     _spacing = 0.0; // mean x spacing of the raw candles
+    ImPlotLimits               _extents;
+    std::vector<mvCandleLevel> _levels;
+    u32                        _sourceVersion = 0; // valueVersion of the source the levels were built from
 };
 
 struct mvCustomSeriesConfig
@@ -481,7 +593,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvScatterSeries : public mvAppItem
@@ -496,7 +608,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvShadeSeries : public mvAppItem
@@ -511,7 +623,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvVLineSeries : public mvAppItem
@@ -526,7 +638,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvHLineSeries : public mvAppItem
@@ -541,7 +653,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvStairSeries : public mvAppItem
@@ -556,7 +668,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mvStemSeries : public mvAppItem
@@ -571,7 +683,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { DearPyGui::set_series_values(configData, ToVectVectDouble(value)); }
 };
 
 class mv2dHistogramSeries : public mvAppItem
@@ -586,7 +698,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); configData.dirty = true; }
 };
 
 class mvErrorSeries : public mvAppItem
@@ -616,7 +728,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); configData.dirty = true; }
 };
 
 class mvHistogramSeries : public mvAppItem
@@ -631,7 +743,7 @@ public:
     void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); configData.dirty = true; }
 };
 
 class mvPieSeries : public mvAppItem
@@ -703,10 +815,10 @@ public:
     void draw(ImDrawList* drawlist, float x, float y) override { DearPyGui::draw_candle_series(drawlist, *this, configData); }
     void handleSpecificKeywordArgs(PyObject* dict) override { DearPyGui::set_configuration(dict, configData); }
     void getSpecificConfiguration(PyObject* dict) override { DearPyGui::fill_configuration_dict(configData, dict); }
-    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); }
+    void setDataSource(mvUUID dataSource) override { DearPyGui::set_data_source(*this, dataSource, configData.value); configData.dirty = true; }
     void* getValue() override { return &configData.value; }
     PyObject* getPyValue() override { return ToPyList(*configData.value); }
-    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); }
+    void setPyValue(PyObject* value) override { *configData.value = ToVectVectDouble(value); configData.dirty = true; }
 };
 
 class mvCustomSeries : public mvAppItem
@@ -2,12 +2,15 @@
 #include <utility>
 
 #include <string>
+#include <cstring>
 #include "mvAppItem.h"
 #include "mvAppItemCommons.h"
 #include "mvContext.h"
 #include "mvItemRegistry.h"
 #include "dearpygui.h"
+#include "mvFontManager.h"
 #include <ctime>
+#include <chrono>
 #include <frameobject.h>
 
 mvGlobalIntepreterLock::mvGlobalIntepreterLock()
@@ -1015,6 +1018,8 @@ ToString(PyObject* value, const std::string& message)
     if (PyUnicode_Check(value))
     {
         result = _PyUnicode_AsString(value);
+        if (!PyUnicode_IS_ASCII(value))
+            mvRequestGlyphs(result.data(), result.size());
     }
     else
     {
@@ -1026,6 +1031,7 @@ ToString(PyObject* value, const std::string& message)
         }
         result = _PyUnicode_AsString(str);
         Py_XDECREF(str);
+        mvRequestGlyphs(result.data(), result.size());
     }
 
     return result;
@@ -1440,6 +1446,115 @@ ToStringVect(PyObject* value, const std::string& message)
     else
         mvThrowPythonError(mvErrorCode::mvWrongType, "Python value error. Must be List[str].");
 
+    for (const auto& item : items)
+        mvRequestGlyphs(item.data(), item.size());
+
+    return items;
+}
+
+// string buffers (numpy 'S'/'U' arrays or newline separated bytes) are
+// split natively to avoid building a python list per item; only used for
+// listbox and combo items, every other StringList argument stays strict
+std::vector<std::string>
+ToStringVectOrBuffer(PyObject* value, const std::string& message)
+{
+    if (value == nullptr || PyTuple_Check(value) || PyList_Check(value) || !PyObject_CheckBuffer(value))
+        return ToStringVect(value, message);
+
+    std::vector<std::string> items;
+    Py_buffer buffer_info;
+
+    if (PyObject_GetBuffer(value, &buffer_info, PyBUF_CONTIG_RO | PyBUF_FORMAT))
+    {
+        PyErr_Clear();
+        mvThrowPythonError(mvErrorCode::mvWrongType, "Python value error. Must be List[str].");
+        return items;
+    }
+
+    const char* format = buffer_info.format ? buffer_info.format : "B";
+    while (*format == '<' || *format == '>' || *format == '=' || *format == '!' || *format == '@')
+        format++;
+    const char kind = format[strlen(format) - 1];
+    const char* data = static_cast<const char*>(buffer_info.buf);
+    Py_ssize_t itemsize = buffer_info.itemsize > 0 ? buffer_info.itemsize : 1;
+    Py_ssize_t count = buffer_info.len / itemsize;
+
+    // fixed width bytes: 'S' (numpy) or 's' (struct) with itemsize > 1
+    if ((kind == 's' || kind == 'S') && itemsize > 1)
+    {
+        items.reserve(count);
+        for (Py_ssize_t i = 0; i < count; i++)
+        {
+            const char* start = data + i * itemsize;
+            size_t length = 0;
+            while (length < (size_t)itemsize && start[length] != 0)
+                length++;
+            items.emplace_back(start, length);
+        }
+    }
+
+    // fixed width UCS4 ('w', numpy 'U' arrays)
+    else if (kind == 'w' && itemsize % 4 == 0)
+    {
+        Py_ssize_t characters = itemsize / 4;
+        items.reserve(count);
+        for (Py_ssize_t i = 0; i < count; i++)
+        {
+            const Py_UCS4* start = reinterpret_cast<const Py_UCS4*>(data + i * itemsize);
+            std::string item;
+            for (Py_ssize_t j = 0; j < characters && start[j] != 0; j++)
+            {
+                Py_UCS4 c = start[j];
+                if (c < 0x80)
+                    item.push_back((char)c);
+                else if (c < 0x800)
+                {
+                    item.push_back((char)(0xC0 | (c >> 6)));
+                    item.push_back((char)(0x80 | (c & 0x3F)));
+                }
+                else if (c < 0x10000)
+                {
+                    item.push_back((char)(0xE0 | (c >> 12)));
+                    item.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+                    item.push_back((char)(0x80 | (c & 0x3F)));
+                }
+                else
+                {
+                    item.push_back((char)(0xF0 | (c >> 18)));
+                    item.push_back((char)(0x80 | ((c >> 12) & 0x3F)));
+                    item.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+                    item.push_back((char)(0x80 | (c & 0x3F)));
+                }
+            }
+            items.push_back(std::move(item));
+        }
+    }
+
+    // single byte buffers are treated as newline separated text
+    else if (itemsize == 1)
+    {
+        const char* end = data + buffer_info.len;
+        const char* start = data;
+        while (start < end)
+        {
+            const char* next = static_cast<const char*>(memchr(start, '\n', end - start));
+            if (next == nullptr)
+                next = end;
+            items.emplace_back(start, next - start);
+            start = next + 1;
+        }
+    }
+
+    else
+    {
+        PyBuffer_Release(&buffer_info);
+        mvThrowPythonError(mvErrorCode::mvWrongType, "Python value error. Must be List[str] or a string buffer.");
+        return items;
+    }
+
+    PyBuffer_Release(&buffer_info);
+    for (const auto& item : items)
+        mvRequestGlyphs(item.data(), item.size());
 
     return items;
 }
@@ -1895,6 +2010,11 @@ VerifyArguments(int start, PyObject* args, const std::vector<mvPythonDataElement
                     return false;
                 break;
 
+            case mvPyDataType::StringListOrBuffer:
+                if (!isPyObject_StringList(obj) && !PyObject_CheckBuffer(obj))
+                    return false;
+                break;
+
             case mvPyDataType::FloatList:
                 if (!isPyObject_FloatList(obj))
                     return false;
@@ -1973,6 +2093,7 @@ PythonDataTypeString(mvPyDataType type)
         case mvPyDataType::Double:         return " : float";
         case mvPyDataType::Bool:           return " : bool";
         case mvPyDataType::StringList:     return " : Union[List[str], Tuple[str, ...]]";
+        case mvPyDataType::StringListOrBuffer: return " : Union[List[str], Tuple[str, ...]]";
         case mvPyDataType::FloatList:      return " : Union[List[float], Tuple[float, ...]]";
         case mvPyDataType::DoubleList:     return " : Union[List[float], Tuple[float, ...]]";
         case mvPyDataType::IntList:        return " : Union[List[int], Tuple[int, ...]]";
@@ -2002,6 +2123,7 @@ PythonDataTypeActual(mvPyDataType type)
         case mvPyDataType::Double:        return "float";
         case mvPyDataType::Bool:          return "bool";
         case mvPyDataType::StringList:    return "Union[List[str], Tuple[str, ...]]";
+        case mvPyDataType::StringListOrBuffer: return "Union[List[str], Tuple[str, ...]]";
         case mvPyDataType::FloatList:     return "Union[List[float], Tuple[float, ...]]";
         case mvPyDataType::IntList:       return "Union[List[int], Tuple[int, ...]]";
         case mvPyDataType::UUIDList:      return "Union[List[int], Tuple[int, ...]]";
@@ -2132,6 +2254,70 @@ FinalizeParser(const mvPythonParserSetup& setup, const std::vector<mvPythonDataE
     return parser;
 }
 
+// caller holds registry.mutex
+static mvPythonParser&
+BuildParser(mvParserRegistry& registry, const std::string& command)
+{
+    auto found = registry.parsers.find(command);
+    if (found != registry.parsers.end())
+        return found->second;
+
+    auto builder = registry.builders.find(command);
+    if (builder == registry.builders.end())
+        return registry.parsers[command];
+
+    auto start = std::chrono::steady_clock::now();
+    mvPythonParser& parser = registry.parsers.emplace(command, builder->second()).first->second;
+    registry.buildTimes[command] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto method = registry.methods.find(command);
+    if (method != registry.methods.end())
+        method->second->ml_doc = parser.documentation.c_str();
+
+    return parser;
+}
+
+mvPythonParser&
+mvParserRegistry::operator[](const std::string& command)
+{
+    std::lock_guard<std::mutex> lk(mutex);
+    return BuildParser(*this, command);
+}
+
+void
+BuildAllParsers(mvParserRegistry& registry)
+{
+    std::lock_guard<std::mutex> lk(registry.mutex);
+
+    if (registry.complete)
+        return;
+
+    for (const auto& builder : registry.builders)
+        BuildParser(registry, builder.first);
+
+    registry.complete = true;
+}
+
+void
+RegisterParserMethods(mvParserRegistry& registry, std::vector<PyMethodDef>& methods)
+{
+    std::lock_guard<std::mutex> lk(registry.mutex);
+
+    registry.methods.clear();
+    for (auto& method : methods)
+    {
+        if (method.ml_name == nullptr)
+            continue;
+
+        registry.methods[method.ml_name] = &method;
+
+        // parsers built before import still get their docstring
+        auto found = registry.parsers.find(method.ml_name);
+        if (found != registry.parsers.end())
+            method.ml_doc = found->second.documentation.c_str();
+    }
+}
+
 bool
 VerifyRequiredArguments(const mvPythonParser& parser, PyObject* args)
 {
@@ -3004,7 +3190,7 @@ AddCommonArgs(std::vector<mvPythonDataElement>& args, CommonParserArgs argsFlags
     if (argsFlags & MV_PARSER_ARG_BEFORE)       args.push_back({ mvPyDataType::UUID, "before", mvArgType::KEYWORD_ARG, "0", "This item will be displayed before the specified item in the parent." });
     if (argsFlags & MV_PARSER_ARG_SOURCE)       args.push_back({ mvPyDataType::UUID, "source", mvArgType::KEYWORD_ARG, "0", "Overrides 'id' as value storage key." });
     if (argsFlags & MV_PARSER_ARG_PAYLOAD_TYPE) args.push_back({ mvPyDataType::String, "payload_type", mvArgType::KEYWORD_ARG, "'$$DPG_PAYLOAD'", "Sender string type must be the same as the target for the target to run the payload_callback." });
-    if (argsFlags & MV_PARSER_ARG_CALLBACK)     args.push_back({ mvPyDataType::Callable, "callback", mvArgType::KEYWORD_ARG, "None", "Registers a callback." });
+    if (argsFlags & MV_PARSER_ARG_CALLBACK)     args.push_back({ mvPyDataType::Callable, "callback", mvArgType::KEYWORD_ARG, "None", "Registers a callback. A PyCapsule named 'dearpygui.native_callback' holding a C function void(uint64_t sender, const mvNativeAppData* app_data, void* user) is instead called on the render thread without the GIL (see mvCallbackRegistry.h)." });
     if (argsFlags & MV_PARSER_ARG_DRAG_CALLBACK)args.push_back({ mvPyDataType::Callable, "drag_callback", mvArgType::KEYWORD_ARG, "None", "Registers a drag callback for drag and drop." });
     if (argsFlags & MV_PARSER_ARG_DROP_CALLBACK)args.push_back({ mvPyDataType::Callable, "drop_callback", mvArgType::KEYWORD_ARG, "None", "Registers a drop callback for drag and drop." });
     if (argsFlags & MV_PARSER_ARG_SHOW)         args.push_back({ mvPyDataType::Bool, "show", mvArgType::KEYWORD_ARG, "True", "Attempt to render widget." });
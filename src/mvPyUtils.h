@@ -9,6 +9,7 @@
 #include <cstring>
 #include <fstream>
 #include <assert.h>
+#include <mutex>
 #include "mvCore.h"
 
 #define PY_SSIZE_T_CLEAN
@@ -180,6 +181,7 @@ std::vector<unsigned char>                       ToUCharVect          (PyObject*
 std::vector<float>                               ToFloatVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of floats.");
 std::vector<double>                              ToDoubleVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of doubles.");
 std::vector<std::string>                         ToStringVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of strings.");
+std::vector<std::string>                         ToStringVectOrBuffer (PyObject* value, const std::string& message = "Type must be a list or tuple of strings."); // also string buffers
 std::vector<std::pair<int, int>>                 ToVectInt2           (PyObject* value, const std::string& message = "Type must be an list/tuple of integer.");
 std::vector<std::pair<std::string, std::string>> ToVectPairString     (PyObject* value, const std::string& message = "Type must be an list/tuple of string pairs.");
 std::vector<std::vector<std::string>>            ToVectVectString     (PyObject* value, const std::string& message = "Type must be an list/tuple of list/tuple of strings.");
@@ -192,7 +194,7 @@ enum class mvPyDataType
 {
     None = 0,
     Integer, Float, Double, String, Bool, Object, Callable, Dict,
-    IntList, FloatList, DoubleList, StringList, ListAny,
+    IntList, FloatList, DoubleList, StringList, StringListOrBuffer, ListAny,
     ListListInt, ListFloatList, ListDoubleList, ListStrList, UUID,
     UUIDList, Long,
     Any
@@ -265,7 +267,25 @@ struct mvPythonParserSetup
     bool                     internal = false;
 };
 
+typedef std::function<mvPythonParser()> mvParserBuilder;
+
+// Commands register a builder at import; the parser (and its docstring)
+// is only built the first time the command is looked up.
+struct mvParserRegistry
+{
+    std::map<std::string, mvParserBuilder> builders;
+    std::map<std::string, mvPythonParser>  parsers;
+    std::map<std::string, double>          buildTimes; // seconds spent in each builder
+    std::map<std::string, PyMethodDef*>    methods;    // ml_doc is filled in once built
+    std::mutex                             mutex;
+    bool                                   complete = false;
+
+    mvPythonParser& operator[](const std::string& command);
+};
+
 mvPythonParser FinalizeParser(const mvPythonParserSetup& setup, const std::vector<mvPythonDataElement>& args);
+void           BuildAllParsers(mvParserRegistry& registry);
+void           RegisterParserMethods(mvParserRegistry& registry, std::vector<PyMethodDef>& methods);
 bool           Parse(const mvPythonParser& parser, PyObject* args, PyObject* kwargs, const char* message, ...);
 const char*    PythonDataTypeActual(mvPyDataType type);
 void           AddCommonArgs(std::vector<mvPythonDataElement>& args, CommonParserArgs argsFlags);
@@ -7,6 +7,23 @@
 #include "mvThemes.h"
 
 #include <unordered_map>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <climits>
+#include <algorithm>
+#include <thread>
+
+// true for a list/tuple starting with a string
+static bool
+IsStringSequence(PyObject* value)
+{
+	if (PyList_Check(value))
+		return PyList_Size(value) > 0 && PyUnicode_Check(PyList_GetItem(value, 0));
+	if (PyTuple_Check(value))
+		return PyTuple_Size(value) > 0 && PyUnicode_Check(PyTuple_GetItem(value, 0));
+	return false;
+}
 
 mvTableCell::mvTableCell(mvUUID uuid)
 	: mvAppItem(uuid)
@@ -52,6 +69,17 @@ void mvTableColumn::handleSpecificKeywordArgs(PyObject* dict)
 
 	if (PyObject* item = PyDict_GetItemString(dict, "init_width_or_weight")) _init_width_or_weight = ToFloat(item);
 
+	if (PyObject* item = PyDict_GetItemString(dict, "sort_keys"))
+	{
+		_sortKeys.clear();
+		_sortKeyStrings.clear();
+		if (IsStringSequence(item))
+			_sortKeyStrings = ToStringVect(item);
+		else if (item != Py_None)
+			_sortKeys = ToDoubleVect(item);
+		_sortKeysChanged = true;
+	}
+
 	// helper for bit flipping
 	auto flagop = [dict](const char* keyword, int flag, int& flags)
 	{
@@ -246,6 +274,17 @@ void mvTable::draw(ImDrawList* drawlist, float x, float y)
 			{
 				if (sorts_specs->SpecsDirty)
 				{
+					if (_nativeSort)
+					{
+						_nativeSortSpecs.clear();
+						for (int i = 0; i < sorts_specs->SpecsCount; i++)
+						{
+							const ImGuiTableColumnSortSpecs& sort_spec = sorts_specs->Specs[i];
+							_nativeSortSpecs.push_back({ sort_spec.ColumnIndex, sort_spec.SortDirection == ImGuiSortDirection_Ascending ? 1 : -1 });
+						}
+						_sortDirty = true;
+					}
+
 					if (sorts_specs->SpecsCount == 0) {
 						mvAddCallbackJob({*this, nullptr});
 					}
@@ -282,13 +321,34 @@ void mvTable::draw(ImDrawList* drawlist, float x, float y)
 
 			std::shared_ptr<mvAppItem> prev_themed_row = nullptr;
 
+			if (_nativeSort)
+			{
+				for (auto& column : childslots[0])
+				{
+					auto columnItem = static_cast<mvTableColumn*>(column.get());
+					_sortDirty |= columnItem->_sortKeysChanged;
+					columnItem->_sortKeysChanged = false;
+				}
+
+				if (_sortDirty)
+					updateRowOrder();
+			}
+
+			// rows are drawn through the sort permutation, if any
+			const bool ordered = _nativeSort && _rowOrder.size() == childslots[1].size();
+			auto row_at = [&](size_t i) -> std::shared_ptr<mvAppItem>&
+			{
+				return childslots[1][ordered ? _rowOrder[i] : i];
+			};
+
 			if (_rows != 0)
 			{
 
 				if (_imguiFilter.IsActive())
 				{
-					for (auto& row : childslots[1])
+					for (size_t i = 0; i < childslots[1].size(); i++)
 					{
+						auto& row = row_at(i);
 						if (!_imguiFilter.PassFilter(row->config.filter.c_str()))
 							continue;
 						row_renderer(row.get());
@@ -303,15 +363,16 @@ void mvTable::draw(ImDrawList* drawlist, float x, float y)
 					while (clipper.Step())
 					{
 						for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
-							row_renderer(childslots[1][row_n].get());
+							row_renderer(row_at(row_n).get());
 
 					}
 					clipper.End();
 				}
 				else
 				{
-					for (auto& row : childslots[1])
+					for (size_t i = 0; i < childslots[1].size(); i++)
 					{
+						auto& row = row_at(i);
 						if (row->config.show)
 						{
 							row_renderer(row.get(), prev_themed_row.get());
@@ -377,7 +438,7 @@ void mvTable::draw(ImDrawList* drawlist, float x, float y)
 
 void mvTable::onChildAdd(std::shared_ptr<mvAppItem> item)
 {
-
+	_sortDirty = true;
 	if (item->type == mvAppItemType::mvTableColumn)
 	{
 		_columns++;
@@ -418,6 +479,7 @@ void mvTable::onChildAdd(std::shared_ptr<mvAppItem> item)
 
 void mvTable::onChildRemoved(std::shared_ptr<mvAppItem> item)
 {
+	_sortDirty = true;
 	int location = item->info.location;
 	if (item->type == mvAppItemType::mvTableColumn)
 	{
@@ -441,6 +503,7 @@ void mvTable::onChildRemoved(std::shared_ptr<mvAppItem> item)
 
 void mvTable::onChildrenRemoved()
 {
+	_sortDirty = true;
 	_columns = (int)childslots[0].size();
 	_rows = (int)childslots[1].size();
 
@@ -461,6 +524,7 @@ void mvTable::onChildrenRemoved()
 
 void mvTable::onChildrenReordered()
 {
+	_sortDirty = true;
 	IM_ASSERT(_rowIDs.size() == childslots[1].size());
 	auto ids_to_index = std::unordered_map<mvUUID, int>();
 	for (int i = 0; i < _rowIDs.size(); i++)
@@ -512,6 +576,156 @@ void mvTable::onChildrenReordered()
 	_rowIDs = std::move(newRowIDs);
 }
 
+struct mvTableSortKey
+{
+	double             number = 0.0;
+	const std::string* text = nullptr; // non null for text keys
+};
+
+static mvTableSortKey
+GetCellSortKey(mvAppItem* cell)
+{
+	mvTableSortKey key;
+
+	// cells created with add_table_cell wrap the actual widget
+	if (cell && cell->type == mvAppItemType::mvTableCell)
+	{
+		mvAppItem* widget = nullptr;
+		for (auto& child : cell->childslots[1])
+		{
+			if (child->type != mvAppItemType::mvTooltip)
+			{
+				widget = child.get();
+				break;
+			}
+		}
+		cell = widget;
+	}
+
+	if (cell == nullptr)
+		return key;
+
+	void* value = cell->getValue();
+	switch (value ? DearPyGui::GetEntityValueType(cell->type) : StorageValueTypes::None)
+	{
+	case StorageValueTypes::String: key.text = static_cast<std::shared_ptr<std::string>*>(value)->get(); break;
+	case StorageValueTypes::Int:    key.number = (double)**static_cast<std::shared_ptr<std::atomic<int>>*>(value); break;
+	case StorageValueTypes::Float:  key.number = (double)**static_cast<std::shared_ptr<std::atomic<float>>*>(value); break;
+	case StorageValueTypes::Double: key.number = **static_cast<std::shared_ptr<std::atomic<double>>*>(value); break;
+	case StorageValueTypes::Bool:   key.number = **static_cast<std::shared_ptr<std::atomic<bool>>*>(value) ? 1.0 : 0.0; break;
+	default:                        key.text = &cell->config.specifiedLabel; break;
+	}
+
+	return key;
+}
+
+// numbers sort before text
+static int
+CompareSortKeys(const mvTableSortKey& left, const mvTableSortKey& right)
+{
+	if (left.text && right.text)
+		return left.text->compare(*right.text);
+	if (left.text || right.text)
+		return left.text ? 1 : -1;
+	return left.number < right.number ? -1 : (right.number < left.number ? 1 : 0);
+}
+
+void mvTable::updateRowOrder()
+{
+	_sortDirty = false;
+
+	const size_t rowCount = childslots[1].size();
+	if (_nativeSortSpecs.empty() || rowCount == 0)
+	{
+		_rowOrder.clear();
+		return;
+	}
+
+	// gather keys column by column: user supplied keys (indexed by row location)
+	// win over cell values
+	std::vector<std::vector<mvTableSortKey>> keys;
+	std::vector<int> directions;
+	for (const auto& spec : _nativeSortSpecs)
+	{
+		if (spec.first < 0 || spec.first >= (int)childslots[0].size())
+			continue;
+
+		auto column = static_cast<mvTableColumn*>(childslots[0][spec.first].get());
+		std::vector<mvTableSortKey> columnKeys(rowCount);
+		for (size_t i = 0; i < rowCount; i++)
+		{
+			mvAppItem* row = childslots[1][i].get();
+			if (i < column->_sortKeyStrings.size())
+				columnKeys[i].text = &column->_sortKeyStrings[i];
+			else if (i < column->_sortKeys.size())
+				columnKeys[i].number = column->_sortKeys[i];
+			else
+			{
+				int columnIndex = -1;
+				for (auto& cell : row->childslots[1])
+				{
+					if (cell->type == mvAppItemType::mvTooltip)
+						continue;
+					if (++columnIndex == spec.first)
+					{
+						columnKeys[i] = GetCellSortKey(cell.get());
+						break;
+					}
+				}
+			}
+		}
+		keys.push_back(std::move(columnKeys));
+		directions.push_back(spec.second);
+	}
+
+	_rowOrder.resize(rowCount);
+	for (size_t i = 0; i < rowCount; i++)
+		_rowOrder[i] = (int)i;
+
+	auto less = [&](int left, int right)
+	{
+		for (size_t k = 0; k < keys.size(); k++)
+		{
+			int result = CompareSortKeys(keys[k][left], keys[k][right]);
+			if (result != 0)
+				return directions[k] > 0 ? result < 0 : result > 0;
+		}
+		return false;
+	};
+
+	// large tables: stable sort chunks on worker threads, then merge in order
+	const size_t minChunk = 16384;
+	size_t chunks = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), rowCount / minChunk);
+	if (chunks < 2)
+	{
+		std::stable_sort(_rowOrder.begin(), _rowOrder.end(), less);
+		return;
+	}
+
+	std::vector<size_t> bounds(chunks + 1);
+	for (size_t i = 0; i <= chunks; i++)
+		bounds[i] = rowCount * i / chunks;
+
+	std::vector<std::thread> workers;
+	for (size_t i = 0; i < chunks; i++)
+	{
+		workers.emplace_back([&, i]() {
+			std::stable_sort(_rowOrder.begin() + bounds[i], _rowOrder.begin() + bounds[i + 1], less);
+			});
+	}
+	for (auto& worker : workers)
+		worker.join();
+
+	for (size_t width = 1; width < chunks; width *= 2)
+	{
+		for (size_t i = 0; i + width < chunks; i += 2 * width)
+		{
+			std::inplace_merge(_rowOrder.begin() + bounds[i], _rowOrder.begin() + bounds[i + width],
+				_rowOrder.begin() + bounds[std::min(i + 2 * width, chunks)], less);
+		}
+	}
+}
+
 void mvTable::handleSpecificKeywordArgs(PyObject* dict)
 {
 	if (dict == nullptr)
@@ -521,6 +735,13 @@ void mvTable::handleSpecificKeywordArgs(PyObject* dict)
 	if (PyObject* item = PyDict_GetItemString(dict, "freeze_columns")) _freezeColumns = ToInt(item);
 	if (PyObject* item = PyDict_GetItemString(dict, "header_row")) _tableHeader = ToBool(item);
 	if (PyObject* item = PyDict_GetItemString(dict, "clipper")) _useClipper = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "native_sort"))
+	{
+		_nativeSort = ToBool(item);
+		_sortDirty = true;
+		if (!_nativeSort)
+			_rowOrder.clear();
+	}
 	if (PyObject* item = PyDict_GetItemString(dict, "inner_width")) _inner_width = (int)ToFloat(item);
 
 	// helper for bit flipping
@@ -589,12 +810,14 @@ void mvTable::getSpecificConfiguration(PyObject* dict)
 	mvPyObject py_inner_width = ToPyInt(_inner_width);
 	mvPyObject py_header_row = ToPyBool(_tableHeader);
 	mvPyObject py_clipper = ToPyBool(_useClipper);
+	mvPyObject py_native_sort = ToPyBool(_nativeSort);
 
 	PyDict_SetItemString(dict, "freeze_rows", py_freeze_rows);
 	PyDict_SetItemString(dict, "freeze_columns", py_freeze_columns);
 	PyDict_SetItemString(dict, "inner_width", py_inner_width);
 	PyDict_SetItemString(dict, "header_row", py_header_row);
 	PyDict_SetItemString(dict, "clipper", py_clipper);
+	PyDict_SetItemString(dict, "native_sort", py_native_sort);
 
 	// helper to check and set bit
 	auto checkbitset = [dict](const char* keyword, int flag, const int& flags)
@@ -664,3 +887,486 @@ void mvTable::setPyValue(PyObject* value)
 	_imguiFilter.InputBuf[i] = 0;
 	_imguiFilter.Build();
 }
+
+
+//-----------------------------------------------------------------------------
+// mvDataTable
+//-----------------------------------------------------------------------------
+
+static bool
+TestRowBit(const std::vector<u32>& bits, size_t row)
+{
+	return (row >> 5) < bits.size() && (bits[row >> 5] >> (row & 31)) & 1u;
+}
+
+static void
+SetRowBit(std::vector<u32>& bits, size_t row, bool value)
+{
+	if ((row >> 5) >= bits.size())
+		bits.resize((row >> 5) + 1, 0u);
+	if (value)
+		bits[row >> 5] |= 1u << (row & 31);
+	else
+		bits[row >> 5] &= ~(1u << (row & 31));
+}
+
+static std::vector<u32>
+ToRowBits(PyObject* value)
+{
+	std::vector<u32> bits;
+	for (int row : ToIntVect(value))
+	{
+		if (row >= 0)
+			SetRowBit(bits, (size_t)row, true);
+	}
+	return bits;
+}
+
+static PyObject*
+ToPyRowList(const std::vector<u32>& bits)
+{
+	std::vector<int> rows;
+	for (size_t i = 0; i < bits.size(); i++)
+	{
+		if (bits[i] == 0u)
+			continue;
+		for (int bit = 0; bit < 32; bit++)
+		{
+			if ((bits[i] >> bit) & 1u)
+				rows.push_back((int)(i * 32 + bit));
+		}
+	}
+	return ToPyList(rows);
+}
+
+// conversion character of a printf format taking exactly one argument,
+// 0 if the format can't be used safely. Length modifiers are accepted;
+// "normalized" (optional) receives the format with the modifier matching
+// what formatCell passes ("ll" for integer conversions, none otherwise)
+static char
+GetFormatConversion(const char* format, std::string* normalized = nullptr)
+{
+	char conversion = 0;
+	if (normalized)
+		normalized->clear();
+	for (const char* c = format; *c; c++)
+	{
+		if (normalized)
+			normalized->push_back(*c);
+		if (*c != '%')
+			continue;
+		c++;
+		if (*c == '%')
+		{
+			if (normalized)
+				normalized->push_back(*c);
+			continue;
+		}
+		const char* spec = c;
+		while (*c && strchr("-+ #0", *c)) c++;
+		while (*c >= '0' && *c <= '9') c++;
+		if (*c == '.')
+		{
+			c++;
+			while (*c >= '0' && *c <= '9') c++;
+		}
+		const char* modifier = c;
+		while (*c && strchr("hlLjzt", *c)) c++;
+		if (*c == 0 || conversion != 0 || !strchr("diouxXceEfFgGaAs", *c))
+			return 0;
+		// wide characters/strings are not supported
+		if (c != modifier && (*c == 'c' || *c == 's'))
+			return 0;
+		conversion = *c;
+
+		if (normalized)
+		{
+			normalized->append(spec, modifier);
+			if (strchr("diouxX", conversion))
+				normalized->append("ll");
+			normalized->push_back(conversion);
+		}
+	}
+	return conversion;
+}
+
+// casting NaN or out of range doubles to integers is undefined
+static long long
+ClampToInteger(double value)
+{
+	if (std::isnan(value))
+		return 0;
+	if (value <= (double)LLONG_MIN)
+		return LLONG_MIN;
+	if (value >= (double)LLONG_MAX)
+		return LLONG_MAX;
+	return (long long)value;
+}
+
+mvDataTable::mvDataTable(mvUUID uuid)
+	: mvAppItem(uuid)
+{
+}
+
+size_t mvDataTable::rowCount() const
+{
+	size_t rows = 0;
+	for (const auto& column : _columns)
+		rows = std::max(rows, column.rows());
+	return rows;
+}
+
+bool mvDataTable::normalizeFormat(mvDataTableColumn& column, std::string& format)
+{
+	if (format.empty())
+		return true;
+
+	std::string normalized;
+	const char conversion = GetFormatConversion(format.c_str(), &normalized);
+	if (conversion == 0)
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(type),
+			"Format must take exactly one argument: " + format, this);
+		format.clear();
+		return false;
+	}
+	if ((conversion == 's') != column.text)
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(type),
+			"Format does not match the column type: " + format, this);
+		format.clear();
+		return false;
+	}
+	format = std::move(normalized);
+	return true;
+}
+
+void mvDataTable::formatCell(const mvDataTableColumn& column, size_t row, char* buffer, size_t size) const
+{
+	const std::string& format = row < column.cellFormats.size() && !column.cellFormats[row].empty()
+		? column.cellFormats[row] : column.format;
+	const char conversion = format.empty() ? 0 : GetFormatConversion(format.c_str());
+
+	buffer[0] = 0;
+
+	if (column.text)
+	{
+		if (row >= column.strings.size())
+			return;
+		if (conversion == 's')
+			snprintf(buffer, size, format.c_str(), column.strings[row].c_str());
+		else
+			snprintf(buffer, size, "%s", column.strings[row].c_str());
+		return;
+	}
+
+	if (row >= column.numbers.size())
+		return;
+
+	const double value = column.numbers[row];
+
+	// integer conversions have no representation for nan/inf
+	if (!std::isfinite(value) && strchr("diouxXc", conversion))
+	{
+		snprintf(buffer, size, "%g", value);
+		return;
+	}
+
+	switch (conversion)
+	{
+	case 'd':
+	case 'i':
+		snprintf(buffer, size, format.c_str(), ClampToInteger(value));
+		break;
+
+	case 'c':
+		snprintf(buffer, size, format.c_str(), (int)(unsigned char)ClampToInteger(value));
+		break;
+
+	case 'o':
+	case 'u':
+	case 'x':
+	case 'X':
+		snprintf(buffer, size, format.c_str(), (unsigned long long)ClampToInteger(value));
+		break;
+
+	case 'e': case 'E':
+	case 'f': case 'F':
+	case 'g': case 'G':
+	case 'a': case 'A':
+		snprintf(buffer, size, format.c_str(), value);
+		break;
+
+	default:
+		snprintf(buffer, size, "%g", value);
+		break;
+	}
+}
+
+void mvDataTable::draw(ImDrawList* drawlist, float x, float y)
+{
+	//-----------------------------------------------------------------------------
+	// pre draw
+	//-----------------------------------------------------------------------------
+
+	// show/hide
+	if (!config.show)
+		return;
+
+	// push font if a font object is attached
+	if (font)
+	{
+		ImFont* fontptr = static_cast<mvFont*>(font.get())->getFontPtr();
+		ImGui::PushFont(fontptr);
+	}
+
+	// themes
+	apply_local_theming(this);
+
+	if (!_columns.empty())
+	{
+		ScopedID id(uuid);
+
+		const int columnCount = (int)_columns.size();
+		const size_t rows = rowCount();
+		const ImU32 highlightColor = _highlightColor;
+
+		if (ImGui::BeginTable(info.internalLabel.c_str(), columnCount, _flags,
+			ImVec2((float)config.width, (float)config.height)))
+		{
+			state.lastFrameUpdate = GContext->frame;
+			state.visible = true;
+
+			ImGui::TableSetupScrollFreeze(0, _tableHeader ? 1 : 0);
+			for (const auto& column : _columns)
+				ImGui::TableSetupColumn(column.header.c_str());
+			if (_tableHeader)
+				ImGui::TableHeadersRow();
+
+			char buffer[256];
+
+			ImGuiListClipper clipper;
+			clipper.Begin((int)rows);
+			while (clipper.Step())
+			{
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+				{
+					ImGui::TableNextRow();
+
+					if (TestRowBit(_highlighted, row))
+						ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1, highlightColor);
+
+					for (int column = 0; column < columnCount; column++)
+					{
+						ImGui::TableSetColumnIndex(column);
+						formatCell(_columns[column], row, buffer, sizeof(buffer));
+
+						if (column != 0 || !_selectable)
+						{
+							ImGui::TextUnformatted(buffer);
+							continue;
+						}
+
+						ImGui::PushID(row);
+						if (ImGui::Selectable(buffer, TestRowBit(_selected, row), ImGuiSelectableFlags_SpanAllColumns))
+						{
+							ImGuiIO& io = ImGui::GetIO();
+							if (io.KeyCtrl)
+								SetRowBit(_selected, row, !TestRowBit(_selected, row));
+							else
+							{
+								std::fill(_selected.begin(), _selected.end(), 0u);
+								if (io.KeyShift && _lastClicked >= 0)
+								{
+									for (int i = std::min(row, _lastClicked); i <= std::max(row, _lastClicked); i++)
+										SetRowBit(_selected, i, true);
+								}
+								else
+									SetRowBit(_selected, row, true);
+							}
+
+							if (!io.KeyShift)
+								_lastClicked = row;
+
+							mvAddCallbackJob({*this, MV_APP_DATA_FUNC(ToPyInt(row))});
+						}
+						ImGui::PopID();
+					}
+				}
+			}
+			clipper.End();
+
+			ImGui::EndTable();
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// post draw
+	//-----------------------------------------------------------------------------
+
+	// pop font off stack
+	if (font)
+		ImGui::PopFont();
+
+	// handle popping themes
+	cleanup_local_theming(this);
+}
+
+void mvDataTable::updateRows(size_t start, PyObject* columns)
+{
+	if (!PyList_Check(columns) && !PyTuple_Check(columns))
+	{
+		mvThrowPythonError(mvErrorCode::mvWrongType, "update_data_table", "columns must be a list of columns.", this);
+		return;
+	}
+
+	const Py_ssize_t count = PySequence_Size(columns);
+	for (Py_ssize_t i = 0; i < count && i < (Py_ssize_t)_columns.size(); i++)
+	{
+		mvPyObject value(PySequence_GetItem(columns, i));
+		if (!value.isOk() || value == Py_None)
+			continue;
+
+		mvDataTableColumn& column = _columns[i];
+		if (column.text)
+		{
+			std::vector<std::string> strings = ToStringVect(value);
+			if (column.strings.size() < start + strings.size())
+				column.strings.resize(start + strings.size());
+			std::move(strings.begin(), strings.end(), column.strings.begin() + start);
+		}
+		else
+		{
+			std::vector<double> numbers = ToDoubleVect(value);
+			if (column.numbers.size() < start + numbers.size())
+				column.numbers.resize(start + numbers.size(), 0.0);
+			std::copy(numbers.begin(), numbers.end(), column.numbers.begin() + start);
+		}
+	}
+}
+
+void mvDataTable::handleSpecificKeywordArgs(PyObject* dict)
+{
+	if (dict == nullptr)
+		return;
+
+	if (PyObject* item = PyDict_GetItemString(dict, "columns"))
+	{
+		_columns.resize(PyList_Check(item) || PyTuple_Check(item) ? PySequence_Size(item) : 0);
+		for (size_t i = 0; i < _columns.size(); i++)
+		{
+			mvPyObject value(PySequence_GetItem(item, i));
+			mvDataTableColumn& column = _columns[i];
+			column.text = IsStringSequence(value);
+			column.numbers.clear();
+			column.strings.clear();
+			if (column.text)
+				column.strings = ToStringVect(value);
+			else
+				column.numbers = ToDoubleVect(value);
+		}
+	}
+
+	if (PyObject* item = PyDict_GetItemString(dict, "headers"))
+	{
+		std::vector<std::string> headers = ToStringVect(item);
+		for (size_t i = 0; i < _columns.size(); i++)
+			_columns[i].header = i < headers.size() ? headers[i] : "";
+	}
+
+	if (PyObject* item = PyDict_GetItemString(dict, "formats"))
+	{
+		const Py_ssize_t count = PyList_Check(item) || PyTuple_Check(item) ? PySequence_Size(item) : 0;
+		for (size_t i = 0; i < _columns.size(); i++)
+		{
+			mvDataTableColumn& column = _columns[i];
+			column.format.clear();
+			column.cellFormats.clear();
+			if ((Py_ssize_t)i >= count)
+				continue;
+
+			mvPyObject value(PySequence_GetItem(item, i));
+			if (PyUnicode_Check(value))
+				column.format = ToString(value);
+			else if (value != Py_None)
+				column.cellFormats = ToStringVect(value);
+
+			if (!normalizeFormat(column, column.format))
+				return;
+			for (auto& format : column.cellFormats)
+			{
+				if (!normalizeFormat(column, format))
+					return;
+			}
+		}
+	}
+
+	if (PyObject* item = PyDict_GetItemString(dict, "highlighted")) _highlighted = ToRowBits(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "highlight_color")) _highlightColor = ToColor(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "header_row")) _tableHeader = ToBool(item);
+	if (PyObject* item = PyDict_GetItemString(dict, "selectable")) _selectable = ToBool(item);
+
+	// helper for bit flipping
+	auto flagop = [dict](const char* keyword, int flag, int& flags)
+	{
+		if (PyObject* item = PyDict_GetItemString(dict, keyword)) ToBool(item) ? flags |= flag : flags &= ~flag;
+	};
+
+	flagop("resizable", ImGuiTableFlags_Resizable, _flags);
+	flagop("reorderable", ImGuiTableFlags_Reorderable, _flags);
+	flagop("hideable", ImGuiTableFlags_Hideable, _flags);
+	flagop("row_background", ImGuiTableFlags_RowBg, _flags);
+	flagop("borders_innerH", ImGuiTableFlags_BordersInnerH, _flags);
+	flagop("borders_outerH", ImGuiTableFlags_BordersOuterH, _flags);
+	flagop("borders_innerV", ImGuiTableFlags_BordersInnerV, _flags);
+	flagop("borders_outerV", ImGuiTableFlags_BordersOuterV, _flags);
+	flagop("scrollX", ImGuiTableFlags_ScrollX, _flags);
+	flagop("scrollY", ImGuiTableFlags_ScrollY, _flags);
+	flagop("no_saved_settings", ImGuiTableFlags_NoSavedSettings, _flags);
+}
+
+void mvDataTable::getSpecificConfiguration(PyObject* dict)
+{
+	if (dict == nullptr)
+		return;
+
+	std::vector<std::string> headers;
+	for (const auto& column : _columns)
+		headers.push_back(column.header);
+
+	PyDict_SetItemString(dict, "headers", mvPyObject(ToPyList(headers)));
+	PyDict_SetItemString(dict, "rows", mvPyObject(ToPyInt((int)rowCount())));
+	PyDict_SetItemString(dict, "highlighted", mvPyObject(ToPyRowList(_highlighted)));
+	PyDict_SetItemString(dict, "highlight_color", mvPyObject(ToPyColor(_highlightColor)));
+	PyDict_SetItemString(dict, "header_row", mvPyObject(ToPyBool(_tableHeader)));
+	PyDict_SetItemString(dict, "selectable", mvPyObject(ToPyBool(_selectable)));
+
+	// helper to check and set bit
+	auto checkbitset = [dict](const char* keyword, int flag, const int& flags)
+	{
+		mvPyObject py_value = ToPyBool(flags & flag);
+		PyDict_SetItemString(dict, keyword, py_value);
+	};
+
+	checkbitset("resizable", ImGuiTableFlags_Resizable, _flags);
+	checkbitset("reorderable", ImGuiTableFlags_Reorderable, _flags);
+	checkbitset("hideable", ImGuiTableFlags_Hideable, _flags);
+	checkbitset("row_background", ImGuiTableFlags_RowBg, _flags);
+	checkbitset("borders_innerH", ImGuiTableFlags_BordersInnerH, _flags);
+	checkbitset("borders_outerH", ImGuiTableFlags_BordersOuterH, _flags);
+	checkbitset("borders_innerV", ImGuiTableFlags_BordersInnerV, _flags);
+	checkbitset("borders_outerV", ImGuiTableFlags_BordersOuterV, _flags);
+	checkbitset("scrollX", ImGuiTableFlags_ScrollX, _flags);
+	checkbitset("scrollY", ImGuiTableFlags_ScrollY, _flags);
+	checkbitset("no_saved_settings", ImGuiTableFlags_NoSavedSettings, _flags);
+}
+
+PyObject* mvDataTable::getPyValue()
+{
+	return ToPyRowList(_selected);
+}
+
+void mvDataTable::setPyValue(PyObject* value)
+{
+	_selected = ToRowBits(value);
+}
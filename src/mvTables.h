@@ -29,6 +29,11 @@ public:
     float _init_width_or_weight = 0.0f;
     ImGuiID _id = 0u;
 
+    // optional sort keys (one per row) used by native sorting
+    std::vector<double>      _sortKeys;
+    std::vector<std::string> _sortKeyStrings;
+    bool                     _sortKeysChanged = false;
+
 };
 
 class mvTableRow : public mvAppItem
@@ -60,6 +65,9 @@ public:
     void onChildrenRemoved();
     void onChildrenReordered();
 
+    // computes _rowOrder from _nativeSortSpecs (stable)
+    void updateRowOrder();
+
     // values
     PyObject* getPyValue() override;
     void setPyValue(PyObject* value) override;
@@ -76,6 +84,11 @@ public:
     ImGuiTableFlags _flags = 0;
     bool _tableHeader = true;
     bool _useClipper = false;
+    bool _nativeSort = false;
+    bool _sortDirty = false;
+
+    std::vector<std::pair<int, int>> _nativeSortSpecs; // column index, direction
+    std::vector<int>                 _rowOrder;        // draw order of rows while natively sorted
 
     float            _scrollX = 0.0f;
     float            _scrollY = 0.0f;
@@ -103,4 +116,60 @@ public:
         int direction;
     };
 
-};
\ No newline at end of file
+};
+
+//-----------------------------------------------------------------------------
+// mvDataTable
+//     * table drawn directly from column data (no row/cell items)
+//     * only visible rows are formatted (ImGuiListClipper)
+//     * selection and highlights are kept as one bit per row
+//-----------------------------------------------------------------------------
+struct mvDataTableColumn
+{
+    std::string              header;
+    std::vector<double>      numbers;     // numeric column
+    std::vector<std::string> strings;     // text column
+    std::string              format;      // printf style with a single argument
+    std::vector<std::string> cellFormats; // optional per cell override of format
+    bool                     text = false;
+
+    size_t rows() const { return text ? strings.size() : numbers.size(); }
+};
+
+class mvDataTable : public mvAppItem
+{
+
+public:
+
+    explicit mvDataTable(mvUUID uuid);
+
+    void draw(ImDrawList* drawlist, float x, float y) override;
+    void handleSpecificKeywordArgs(PyObject* dict) override;
+    void getSpecificConfiguration(PyObject* dict) override;
+
+    // values (selected rows)
+    PyObject* getPyValue() override;
+    void setPyValue(PyObject* value) override;
+
+    // overwrites rows [start, start + n) of the supplied columns
+    // (None entries leave a column untouched), growing them as needed
+    void updateRows(size_t start, PyObject* columns);
+
+private:
+
+    size_t rowCount() const;
+    void   formatCell(const mvDataTableColumn& column, size_t row, char* buffer, size_t size) const;
+    bool   normalizeFormat(mvDataTableColumn& column, std::string& format); // raises if unusable
+
+private:
+
+    std::vector<mvDataTableColumn> _columns;
+    std::vector<u32>               _selected;    // bitset
+    std::vector<u32>               _highlighted; // bitset
+    mvColor                        _highlightColor = { 0.26f, 0.59f, 0.98f, 0.35f };
+    ImGuiTableFlags                _flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg;
+    bool                           _tableHeader = true;
+    bool                           _selectable = true;
+    int                            _lastClicked = -1;
+
+};
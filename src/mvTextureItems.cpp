@@ -12,6 +12,10 @@ mvTextureRegistry::mvTextureRegistry(mvUUID uuid)
 void mvTextureRegistry::draw(ImDrawList* drawlist, float x, float y)
 {
 
+	// replaying input has no renderer to upload to
+	if (GContext->inputRecorder.replaying)
+		return;
+
 	for (auto& item : childslots[1])
 		item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 
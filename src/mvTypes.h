@@ -5,6 +5,9 @@
 typedef bool b8;
 typedef std::int32_t b32;
 typedef std::int32_t i32;
+typedef std::uint8_t u8;
+typedef std::uint16_t u16;
 typedef std::uint32_t u32;
 typedef float f32;
+typedef double f64;
 typedef unsigned long long mvUUID;
\ No newline at end of file
@@ -35,6 +35,12 @@ void  UpdateTexture(void* texture, u32 width, u32 height, std::vector<f32>& data
 void* LoadTextureFromArrayRaw(u32 width, u32 height, f32* data, i32 components);
 void  UpdateRawTexture(void* texture, u32 width, u32 height, f32* data, i32 components);
 
+// 8-bit RGBA textures
+void* LoadTextureFromArrayRGBA8(u32 width, u32 height, const u8* data);
+
+// partial update of an 8-bit RGBA texture (i.e. the font atlas)
+void  UpdateTextureRegion(void* texture, u32 x, u32 y, u32 width, u32 height, const u8* data);
+
 // framebuffer output
 void OutputFrameBuffer(const char* filepath);
 void OutputFrameBufferArray(PymvBuffer* out);
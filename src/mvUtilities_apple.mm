@@ -146,4 +146,28 @@ UpdateTexture(void* texture, unsigned width, unsigned height, std::vector<float>
 {
     id <MTLTexture> out_srv = (__bridge id <MTLTexture>)texture;
     [out_srv replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * components * 4];
+}
+
+    void* LoadTextureFromArrayRGBA8(unsigned width, unsigned height, const unsigned char* data)
+{
+    mvGraphics& graphics = GContext->graphics;
+    auto graphicsData = (mvGraphics_Metal*)graphics.backendSpecifics;
+
+    MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA8Unorm width:width height:height mipmapped:NO];
+
+    textureDescriptor.usage = MTLTextureUsageShaderRead;
+    textureDescriptor.storageMode = MTLStorageModeManaged;
+
+    id <MTLTexture> texture = [graphicsData->device newTextureWithDescriptor:textureDescriptor];
+    [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
+
+    g_textures.push_back({texture, texture});
+
+    return (__bridge void*)g_textures.back().second;
+}
+
+void UpdateTextureRegion(void* texture, unsigned x, unsigned y, unsigned width, unsigned height, const unsigned char* data)
+{
+    id <MTLTexture> out_srv = (__bridge id <MTLTexture>)texture;
+    [out_srv replaceRegion:MTLRegionMake2D(x, y, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
 }
\ No newline at end of file
@@ -385,6 +385,59 @@ UpdateRawTexture(void* texture, unsigned width, unsigned height, float* data, in
     resource->Release();
 }
 
+ void*
+LoadTextureFromArrayRGBA8(unsigned width, unsigned height, const unsigned char* data)
+{
+    mvGraphics_D3D11* graphicsData = (mvGraphics_D3D11*)GContext->graphics.backendSpecifics;
+    ID3D11ShaderResourceView* out_srv = nullptr;
+
+    // Create texture (default usage, updated through UpdateTextureRegion)
+    D3D11_TEXTURE2D_DESC desc;
+    ZeroMemory(&desc, sizeof(desc));
+    desc.Width = width;
+    desc.Height = height;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    desc.CPUAccessFlags = 0;
+    desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+    ID3D11Texture2D* pTexture = NULL;
+    D3D11_SUBRESOURCE_DATA subResource;
+    subResource.pSysMem = data;
+    subResource.SysMemPitch = desc.Width * 4;
+    subResource.SysMemSlicePitch = 0;
+    graphicsData->device->CreateTexture2D(&desc, &subResource, &pTexture);
+
+    // Create texture view
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    ZeroMemory(&srvDesc, sizeof(srvDesc));
+    srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = desc.MipLevels;
+    srvDesc.Texture2D.MostDetailedMip = 0;
+    graphicsData->device->CreateShaderResourceView(pTexture, &srvDesc, &out_srv);
+    pTexture->Release();
+
+    return out_srv;
+}
+
+ void
+UpdateTextureRegion(void* texture, unsigned x, unsigned y, unsigned width, unsigned height, const unsigned char* data)
+{
+    mvGraphics_D3D11* graphicsData = (mvGraphics_D3D11*)GContext->graphics.backendSpecifics;
+    ID3D11ShaderResourceView* view = (ID3D11ShaderResourceView*)texture;
+
+    // the font texture is created with D3D11_USAGE_DEFAULT, so it can't be mapped
+    ID3D11Resource* resource;
+    view->GetResource(&resource);
+    D3D11_BOX box = { x, y, 0, x + width, y + height, 1 };
+    graphicsData->deviceContext->UpdateSubresource(resource, 0, &box, data, width * 4, 0);
+    resource->Release();
+}
+
  void*
 LoadTextureFromArrayRaw(unsigned width, unsigned height, float* data, int components)
 {
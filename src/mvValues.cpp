@@ -33,7 +33,7 @@ void mvBoolValue::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
-	_value = *static_cast<std::shared_ptr<bool>*>(item->getValue());
+	_value = *static_cast<std::shared_ptr<std::atomic<bool>>*>(item->getValue());
 }
 
 PyObject* mvColorValue::getPyValue()
@@ -151,7 +151,7 @@ void mvDoubleValue::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
-	_value = *static_cast<std::shared_ptr<double>*>(item->getValue());
+	_value = *static_cast<std::shared_ptr<std::atomic<double>>*>(item->getValue());
 }
 
 PyObject* mvFloat4Value::getPyValue()
@@ -222,7 +222,7 @@ void mvFloatValue::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
-	_value = *static_cast<std::shared_ptr<float>*>(item->getValue());
+	_value = *static_cast<std::shared_ptr<std::atomic<float>>*>(item->getValue());
 }
 
 PyObject* mvFloatVectValue::getPyValue()
@@ -314,7 +314,7 @@ void mvIntValue::setDataSource(mvUUID dataSource)
 			"Values types do not match: " + std::to_string(dataSource), this);
 		return;
 	}
-	_value = *static_cast<std::shared_ptr<int>*>(item->getValue());
+	_value = *static_cast<std::shared_ptr<std::atomic<int>>*>(item->getValue());
 }
 
 PyObject* mvIntValue::getPyValue()
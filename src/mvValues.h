@@ -30,7 +30,7 @@ public:
 
 private:
 
-    std::shared_ptr<bool> _value = std::make_shared<bool>(false);
+    std::shared_ptr<std::atomic<bool>> _value = std::make_shared<std::atomic<bool>>(false);
     bool  _disabled_value = false;
 };
 
@@ -94,7 +94,7 @@ public:
 
 private:
 
-    std::shared_ptr<double> _value = std::make_shared<double>(0.0);
+    std::shared_ptr<std::atomic<double>> _value = std::make_shared<std::atomic<double>>(0.0);
     float         _disabled_value = 0.0;
 
 };
@@ -138,7 +138,7 @@ public:
 
 private:
 
-    std::shared_ptr<float> _value = std::make_shared<float>(0.0f);
+    std::shared_ptr<std::atomic<float>> _value = std::make_shared<std::atomic<float>>(0.0f);
     float  _disabled_value = 0.0f;
 
 };
@@ -202,7 +202,7 @@ public:
 
 private:
 
-    std::shared_ptr<int> _value = std::make_shared<int>(0);
+    std::shared_ptr<std::atomic<int>> _value = std::make_shared<std::atomic<int>>(0);
     int        _disabled_value = 0;
 
 };
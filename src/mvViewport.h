@@ -9,12 +9,25 @@
 //-----------------------------------------------------------------------------
 
 #include "mvContext.h"
+#include <chrono>
 #include <imgui.h>
 #include "mvCallbackRegistry.h"
 #include "mvGraphics.h"
 
 struct GLFWwindow;
 
+struct mvFramePacing
+{
+	std::chrono::steady_clock::time_point lastFrame;
+	f64 sleepMean       = 0.002; // running estimate of what a 1ms sleep really costs
+	f64 sleepVariance   = 0.0;   // and its spread, spinning covers the remainder
+	f64 targetTime      = 0.0;   // frame time aimed for on the last frame, 0 if uncapped
+	b8  highResolution  = false; // OS timer resolution raised for sleeping (see mvSetTimerResolution)
+	f64 frameTimes[120] = {};    // achieved frame times, ring buffer
+	i32 frameCount      = 0;
+	i32 nextFrame       = 0;
+};
+
 struct mvViewport
 {
 	b8 running = true;
@@ -52,6 +65,18 @@ struct mvViewport
 	i32 xpos         = 100;
 	i32 ypos         = 100;
 
+	// window state, updated by the platform every frame
+	b8 focused   = true;
+	b8 minimized = false;
+
+	// frame pacing (see mvPaceFrame)
+	f32           maxFps       = 0.0f;  // 0: uncapped
+	f32           minFrameTime = 0.0f;  // seconds, 0: uncapped
+	b8            adaptiveFps  = false; // drop to idleFps when unfocused, minimized or idle
+	f32           idleFps      = 10.0f;
+	f32           idleTime     = 1.0f;  // seconds without input before the app counts as idle
+	mvFramePacing pacing;
+
 	void* platformSpecifics = nullptr; // platform specifics
 
 };
@@ -64,6 +89,8 @@ void        mvMinimizeViewport(mvViewport& viewport);
 void        mvRestoreViewport (mvViewport& viewport);
 void        mvRenderFrame();
 void        mvToggleFullScreen(mvViewport& viewport);
+void        mvPaceFrame       (mvViewport& viewport); // platform independent, after mvRenderFrame
+void        mvSetTimerResolution(mvViewport& viewport, b8 high); // ~1ms sleeps while pacing (Windows), no-op elsewhere
 
 static void mvOnResize()
 {
@@ -179,6 +179,8 @@ mvRenderFrame()
     auto graphicsData = (mvGraphics_Metal*)graphics.backendSpecifics;
 
     viewport->running = !glfwWindowShouldClose(viewportData->handle);
+    viewport->focused = glfwGetWindowAttrib(viewportData->handle, GLFW_FOCUSED) != 0;
+    viewport->minimized = glfwGetWindowAttrib(viewportData->handle, GLFW_ICONIFIED) != 0;
 
     if(viewport->posDirty)
     {
@@ -232,6 +234,7 @@ mvRenderFrame()
             mvToolManager::GetFontManager().updateAtlas();
             ImGui_ImplMetal_CreateFontsTexture(graphicsData->device);
         }
+        mvToolManager::GetFontManager().updateDynamicGlyphs();
 
         NSWindow *nswin = glfwGetCocoaWindow(viewportData->handle);
         if(nswin.isVisible && (nswin.occlusionState & NSWindowOcclusionStateVisible) == 0)
@@ -314,4 +317,11 @@ mvToggleFullScreen(mvViewport& viewport)
         glfwSetWindowMonitor(viewportData->handle, monitor, 0, 0, mode->width, mode->height, framerate);
         GContext->viewport->fullScreen = true;
     }
-}
\ No newline at end of file
+}
+
+void
+mvSetTimerResolution(mvViewport& viewport, b8 high)
+{
+    // sleeps are already fine grained here
+    viewport.pacing.highResolution = high;
+}
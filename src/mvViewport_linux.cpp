@@ -56,6 +56,8 @@ mvPrerender()
     auto viewportData = (mvViewportData*)viewport->platformSpecifics;
 
     viewport->running = !glfwWindowShouldClose(viewportData->handle);
+    viewport->focused = glfwGetWindowAttrib(viewportData->handle, GLFW_FOCUSED) != 0;
+    viewport->minimized = glfwGetWindowAttrib(viewportData->handle, GLFW_ICONIFIED) != 0;
 
     if (viewport->posDirty)
     {
@@ -107,6 +109,7 @@ mvPrerender()
         ImGui_ImplOpenGL3_DestroyDeviceObjects();
         mvToolManager::GetFontManager().updateAtlas();
     }
+    mvToolManager::GetFontManager().updateDynamicGlyphs();
 
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
@@ -307,4 +310,11 @@ mvToggleFullScreen(mvViewport& viewport)
         glfwSetWindowMonitor(viewportData->handle, monitor, 0, 0, mode->width, mode->height, framerate);
         viewport.fullScreen = true;
     }
-}
\ No newline at end of file
+}
+
+void
+mvSetTimerResolution(mvViewport& viewport, b8 high)
+{
+    // sleeps are already fine grained here
+    viewport.pacing.highResolution = high;
+}
@@ -1,4 +1,5 @@
 #include "mvWindowsSpecifics.h"
+#include <timeapi.h>
 
 
 static BYTE gprevious_ime_char;
@@ -46,6 +47,8 @@ mvPrerender(mvViewport& viewport)
 
 	if (viewportData->msg.message == WM_QUIT)
 		viewport.running = false;
+	viewport.focused = ::GetForegroundWindow() == viewportData->handle;
+	viewport.minimized = ::IsIconic(viewportData->handle) != 0;
 
 	{
 		// TODO: we probably need a separate mutex for this
@@ -114,6 +117,7 @@ mvPrerender(mvViewport& viewport)
 			ImGui_ImplDX11_InvalidateDeviceObjects();
 			mvToolManager::GetFontManager().updateAtlas();
 		}
+		mvToolManager::GetFontManager().updateDynamicGlyphs();
 	}
 
 	// Start the Dear ImGui frame
@@ -484,6 +488,7 @@ void
 mvCleanupViewport(mvViewport& viewport)
 {
 	mvViewportData* viewportData = (mvViewportData*)viewport.platformSpecifics;
+	mvSetTimerResolution(viewport, false);
 	ImGui_ImplWin32_Shutdown();
 	::DestroyWindow(viewportData->handle);
 	::UnregisterClass(viewportData->wc.lpszClassName, viewportData->wc.hInstance);
@@ -533,4 +538,19 @@ mvToggleFullScreen(mvViewport& viewport)
 		MoveWindow(viewportData->handle, 0, 0, width, height, TRUE);
 		GContext->viewport->fullScreen = true;
 	}
-}
\ No newline at end of file
+}
+
+void
+mvSetTimerResolution(mvViewport& viewport, b8 high)
+{
+	// the default sleep granularity is ~15.6ms, far too coarse to pace
+	// frames, so it is raised to 1ms only while a frame cap is active
+	if (high == viewport.pacing.highResolution)
+		return;
+
+	if (high)
+		timeBeginPeriod(1);
+	else
+		timeEndPeriod(1);
+	viewport.pacing.highResolution = high;
+}
@@ -1,6 +1,17 @@
+import array
+import ctypes
+import marshal
+import os
+import struct
+import tempfile
 import unittest
 import dearpygui.dearpygui as dpg
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 
 class TestSimple(unittest.TestCase):
 
@@ -257,5 +268,372 @@ class TestItemDetails(unittest.TestCase):
         dpg.destroy_context()
 
 
+class TestItemTree(unittest.TestCase):
+
+    # tests save_item_tree/load_item_tree round-trips and clone_item
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        with dpg.window() as self.window_id:
+            pass
+
+        dpg.setup_dearpygui()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_save_load_round_trip(self):
+
+        def on_change(sender, app, user):
+            pass
+
+        def on_change_restored(sender, app, user):
+            pass
+
+        with dpg.group(parent=self.window_id) as group:
+            amount = dpg.add_input_int(label="amount", width=120, default_value=7, callback=on_change)
+            mirror = dpg.add_drag_int(source=amount)
+        dpg.set_value(amount, 42)
+
+        with tempfile.TemporaryDirectory() as folder:
+            file = os.path.join(folder, "tree.dpgt")
+            dpg.save_item_tree(group, file)
+            restored = dpg.load_item_tree(file, parent=self.window_id,
+                                          callbacks={on_change.__qualname__: on_change_restored})
+
+        self.assertNotEqual(restored, group)
+        children = dpg.get_item_children(restored, 1)
+        self.assertEqual(len(children), 2)
+        restored_amount, restored_mirror = children
+        self.assertNotEqual(restored_amount, amount)
+        self.assertNotEqual(restored_mirror, mirror)
+
+        # configuration and value
+        self.assertEqual(dpg.get_item_type(restored_amount), dpg.get_item_type(amount))
+        self.assertEqual(dpg.get_item_label(restored_amount), "amount")
+        self.assertEqual(dpg.get_item_width(restored_amount), 120)
+        self.assertEqual(dpg.get_value(restored_amount), 42)
+
+        # sources inside the tree point at the restored items
+        self.assertEqual(dpg.get_item_source(restored_mirror), restored_amount)
+
+        # callbacks are rebound by name
+        self.assertIs(dpg.get_item_callback(restored_amount), on_change_restored)
+
+    def test_clone_item(self):
+
+        with dpg.group(parent=self.window_id) as group:
+            dpg.add_input_int(tag="field", default_value=3)
+
+        clones = dpg.clone_item(group, count=2, alias_pattern="{alias}_{n}", share_values=True)
+        self.assertEqual(len(clones), 2)
+        self.assertEqual(len(dpg.get_item_children(self.window_id, 1)), 3)
+
+        # aliases follow the pattern, one per copy
+        self.assertTrue(dpg.does_alias_exist("field_0"))
+        self.assertTrue(dpg.does_alias_exist("field_1"))
+        self.assertEqual(dpg.get_item_children(clones[0], 1)[0], dpg.get_alias_id("field_0"))
+
+        # shared values follow the original
+        self.assertEqual(dpg.get_value("field_0"), 3)
+        dpg.set_value("field", 9)
+        self.assertEqual(dpg.get_value("field_0"), 9)
+        self.assertEqual(dpg.get_value("field_1"), 9)
+
+        # without an alias pattern copies stay unnamed and own their values
+        single = dpg.clone_item("field")
+        self.assertEqual(dpg.get_item_alias(single[0]), "")
+        dpg.set_value(single[0], 5)
+        self.assertEqual(dpg.get_value("field"), 9)
+
+        with self.assertRaises(Exception):
+            dpg.clone_item(group, count=0)
+
+        # later copies would silently go without an alias
+        with self.assertRaises(Exception):
+            dpg.clone_item(group, count=2, alias_pattern="{alias}_copy")
+        self.assertEqual(len(dpg.get_item_children(self.window_id, 1)), 3)
+
+    def test_outside_references(self):
+
+        with dpg.theme(tag="shared_theme"):
+            pass
+        with dpg.item_handler_registry() as handlers:
+            pass
+        button = dpg.add_button(parent=self.window_id)
+        dpg.bind_item_theme(button, "shared_theme")
+        dpg.bind_item_handler_registry(button, handlers)
+
+        with tempfile.TemporaryDirectory() as folder:
+            file = os.path.join(folder, "tree.dpgt")
+            dpg.save_item_tree(button, file)
+
+            # a new session hands the saved uuids to unrelated items
+            dpg.destroy_context()
+            dpg.create_context()
+            with dpg.window() as self.window_id:
+                pass
+            dpg.setup_dearpygui()
+            with dpg.theme():
+                pass
+            with dpg.item_handler_registry():
+                pass
+            with dpg.theme(tag="shared_theme") as theme:
+                pass
+
+            restored = dpg.load_item_tree(file, parent=self.window_id)
+
+        # found by alias, unaliased targets are dropped
+        info = dpg.get_item_info(restored)
+        self.assertEqual(info["theme"], theme)
+        self.assertIsNone(info["handlers"])
+
+    def test_malformed_children(self):
+
+        record = {"type": "add_group", "uuid": 1, "config": {}, "callbacks": {}, "children": 5}
+        with tempfile.TemporaryDirectory() as folder:
+            file = os.path.join(folder, "tree.dpgt")
+            with open(file, "wb") as f:
+                f.write(b"DPGT" + struct.pack("=I", 2) + marshal.dumps(record))
+            with self.assertRaises(Exception):
+                dpg.load_item_tree(file, parent=self.window_id)
+
+        self.assertEqual(dpg.get_item_children(self.window_id, 1), [])
+
+
+class TestTransformPoints(unittest.TestCase):
+
+    # tests apply_transform_points on lists and buffers
+
+    def setUp(self):
+        dpg.create_context()
+
+    def tearDown(self):
+        dpg.destroy_context()
+
+    def test_list_points(self):
+        matrix = dpg.create_translation_matrix([1.0, 2.0])
+        points = dpg.apply_transform_points(matrix, [[0.0, 0.0], [1.0, 1.0]])
+        self.assertEqual(points[0][:2], [1.0, 2.0])
+        self.assertEqual(points[1][:2], [2.0, 3.0])
+
+    def test_buffer_points(self):
+        matrix = dpg.create_translation_matrix([1.0, 2.0])
+        data = memoryview(array.array('f', [0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 0.0, 1.0])).cast('B').cast('f', (2, 4))
+        points = dpg.apply_transform_points(matrix, data)
+        self.assertEqual(points.shape, (2, 4))
+        self.assertEqual(points.tolist()[1][:2], [2.0, 3.0])
+
+    @unittest.skipUnless(numpy, "numpy is not installed")
+    def test_empty_buffer(self):
+        matrix = dpg.create_translation_matrix([1.0, 2.0])
+        points = dpg.apply_transform_points(matrix, numpy.zeros((0, 4), dtype=numpy.float32))
+        self.assertEqual(len(points), 0)
+
+    @unittest.skipUnless(numpy, "numpy is not installed")
+    def test_unreadable_buffer(self):
+        matrix = dpg.create_translation_matrix([1.0, 2.0])
+        strided = numpy.zeros((4, 8), dtype=numpy.float32)[:, ::2]
+        with self.assertRaises(Exception):
+            dpg.apply_transform_points(matrix, strided)
+
+class TestDataTable(unittest.TestCase):
+
+    # tests data_table format validation
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        with dpg.window() as self.window_id:
+            pass
+
+        dpg.setup_dearpygui()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_length_modifiers_accepted(self):
+        dpg.add_data_table(parent=self.window_id,
+                           columns=[[1.0, float('nan'), 1e300], [2.5, 3.5, 4.5], ["a", "b", "c"]],
+                           formats=["%ld", "%.2lf", "%s"])
+
+    def test_invalid_formats_raise(self):
+        with self.assertRaises(Exception):
+            dpg.add_data_table(parent=self.window_id, columns=[[1.0, 2.0]], formats=["%d of %d"])
+        with self.assertRaises(Exception):
+            dpg.add_data_table(parent=self.window_id, columns=[[1.0, 2.0]], formats=["%s"])
+        with self.assertRaises(Exception):
+            dpg.add_data_table(parent=self.window_id, columns=[["a", "b"]], formats=["%ls"])
+
+class TestStringItems(unittest.TestCase):
+
+    # tests string buffers for listbox/combo items and strict string lists elsewhere
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        with dpg.window() as self.window_id:
+            pass
+
+        dpg.setup_dearpygui()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_listbox_bytes_items(self):
+        listbox = dpg.add_listbox(b"alpha\nbeta\ngamma", parent=self.window_id)
+        self.assertEqual(dpg.get_item_configuration(listbox)["items"], ["alpha", "beta", "gamma"])
+
+    def test_combo_bytes_items(self):
+        combo = dpg.add_combo(parent=self.window_id)
+        dpg.configure_item(combo, items=b"one\ntwo")
+        self.assertEqual(dpg.get_item_configuration(combo)["items"], ["one", "two"])
+
+    def test_string_list_rejects_bytes(self):
+        with self.assertRaises(Exception):
+            dpg.add_radio_button(b"alpha\nbeta", parent=self.window_id)
+
+class NativeAppData(ctypes.Structure):
+
+    class _Data(ctypes.Union):
+        _fields_ = [("i", ctypes.c_int), ("f", ctypes.c_float), ("d", ctypes.c_double), ("v", ctypes.c_float * 4)]
+
+    _anonymous_ = ("data",)
+    _fields_ = [("type", ctypes.c_int), ("data", _Data)]
+
+NATIVE_CALLBACK = ctypes.CFUNCTYPE(None, ctypes.c_ulonglong, ctypes.POINTER(NativeAppData), ctypes.c_void_p)
+
+class TestNativeCallbacks(unittest.TestCase):
+
+    # tests native (capsule) callbacks of global handlers through an input replay
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.create_viewport()
+        dpg.setup_dearpygui()
+
+        self.received = []
+        self.function = NATIVE_CALLBACK(lambda sender, app_data, user: self.received.append((app_data.contents.type, app_data.contents.i)))
+        self.name = b"dearpygui.native_callback"
+        capsule_new = ctypes.pythonapi.PyCapsule_New
+        capsule_new.restype = ctypes.py_object
+        capsule_new.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_void_p]
+        self.capsule = capsule_new(ctypes.cast(self.function, ctypes.c_void_p), self.name, None)
+
+        fd, self.file = tempfile.mkstemp(suffix=".dpgi")
+        with os.fdopen(fd, "wb") as f:
+            f.write(b"DPGI" + struct.pack("=I", 2))
+            for mouse_down in (0, 0, 2, 2, 0, 0):
+                f.write(struct.pack("=7f2B3H", 1.0 / 60.0, 800.0, 600.0, 10.0, 10.0, 0.0, 0.0, mouse_down, 0, 0, 0, 0))
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+        os.remove(self.file)
+
+    def test_mouse_click_payload(self):
+        with dpg.handler_registry():
+            dpg.add_mouse_click_handler(callback=self.capsule)
+        dpg.start_input_replay(self.file)
+        while dpg.is_dearpygui_running():
+            dpg.render_dearpygui_frame()
+        dpg.stop_input_replay()
+
+        # mvNativeData_Int with the button code, not the handler's (missing) value
+        self.assertIn((2, 1), self.received)
+
+class TestItemState(unittest.TestCase):
+
+    # tests one-shot state queries against an input replay hovering a button
+
+    def setUp(self):
+
+        dpg.create_context()
+        dpg.create_viewport()
+        dpg.setup_dearpygui()
+
+        with dpg.window() as self.window_id:
+            self.button = dpg.add_button(label="button", width=200, height=100)
+        dpg.set_primary_window(self.window_id, True)
+
+        fd, self.file = tempfile.mkstemp(suffix=".dpgi")
+        with os.fdopen(fd, "wb") as f:
+            f.write(b"DPGI" + struct.pack("=I", 2))
+            for _ in range(6):
+                f.write(struct.pack("=7f2B3H", 1.0 / 60.0, 800.0, 600.0, 40.0, 40.0, 0.0, 0.0, 0, 0, 0, 0, 0))
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+        os.remove(self.file)
+
+    def test_state_keys(self):
+        state = dpg.get_item_state(self.button)
+        for key in ("hovered", "active", "clicked", "edited", "activated", "deactivated"):
+            self.assertIn(key, state)
+        self.assertIsInstance(dpg.is_item_hovered(self.button), bool)
+        self.assertIsInstance(dpg.is_item_clicked(self.button), bool)
+
+    def test_first_query_is_captured(self):
+        hovered = None
+        frames = 0
+        dpg.start_input_replay(self.file)
+        while dpg.is_dearpygui_running():
+            dpg.render_dearpygui_frame()
+            frames += 1
+            if frames == 4:
+                # first query for this item, the state must already be there
+                hovered = dpg.is_item_hovered(self.button)
+        dpg.stop_input_replay()
+        self.assertTrue(hovered)
+
+class TestItemStates(unittest.TestCase):
+
+    # tests the batched, column-shaped item state query
+
+    def setUp(self):
+
+        dpg.create_context()
+
+        with dpg.window() as self.window_id:
+            self.first = dpg.add_button(label="first")
+            self.second = dpg.add_button(label="second", pos=(30, 40))
+
+        dpg.setup_dearpygui()
+
+    def tearDown(self):
+        dpg.stop_dearpygui()
+        dpg.destroy_context()
+
+    def test_column_shapes(self):
+        states = dpg.get_item_states([self.first, self.second], ["ok", "pos", "rect"])
+        self.assertEqual(sorted(states.keys()), ["ok", "pos", "rect"])
+        self.assertEqual(states["ok"].shape, (2,))
+        self.assertEqual(states["pos"].shape, (2, 2))
+        self.assertEqual(states["rect"].shape, (2, 4))
+        self.assertEqual(states["ok"].tolist(), [True, True])
+        self.assertEqual(states["pos"].tolist()[1], [30.0, 40.0])
+
+    def test_default_fields(self):
+        states = dpg.get_item_states([self.first])
+        self.assertEqual(sorted(states.keys()), ["rect", "visible"])
+        self.assertEqual(states["visible"].tolist(), [False])
+
+    def test_missing_item_row(self):
+        states = dpg.get_item_states([self.first, 999999], ["ok"])
+        self.assertEqual(states["ok"].tolist(), [True, False])
+
+    def test_unknown_field(self):
+        with self.assertRaises(Exception):
+            dpg.get_item_states([self.first], ["ok", "not_a_field"])
+
 if __name__ == '__main__':
     unittest.main(argv=['first-arg-is-ignored'], verbosity=2, exit=should_exit)